@@ -1,63 +1,293 @@
 ﻿#include "CDN/CoDCDNCache.h"
 
-bool FCoDCDNCache::Load(const FString& Name)
+#include "Async/Async.h"
+#include "Hash/xxhash.h"
+#include "Utils/FileHandlePool.h"
+
+namespace
 {
-	FString CdnDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IWToUE"), TEXT("cdn_cache"));
+	constexpr uint32 CDNInfoSignature = 0x494E4443;
+	constexpr uint32 CDNInfoVersion = 4;
+	// Copy buffer used by compaction.
+	constexpr int64 CompactionChunkSize = 4 * 1024 * 1024;
+
+	bool CopyFileRange(IFileHandle& Source, IFileHandle& Target, int64 Offset, int64 Size, TArray<uint8>& ScratchBuffer)
+	{
+		while (Size > 0)
+		{
+			const int64 ChunkSize = FMath::Min(Size, CompactionChunkSize);
+			ScratchBuffer.SetNumUninitialized(ChunkSize, EAllowShrinking::No);
+			if (!Source.ReadAt(ScratchBuffer.GetData(), ChunkSize, Offset) ||
+				!Target.Write(ScratchBuffer.GetData(), ChunkSize))
+			{
+				return false;
+			}
+			Offset += ChunkSize;
+			Size -= ChunkSize;
+		}
+		return true;
+	}
+}
 
-	InfoFilePath = FPaths::Combine(CdnDir, Name + TEXT(".cdn_info"));
-	DataFilePath = FPaths::Combine(CdnDir, Name + TEXT(".cdn_data"));
+FCoDCDNCache::~FCoDCDNCache()
+{
+	if (CompactionTask.IsValid())
+	{
+		CompactionTask.Wait();
+	}
+	if (bIsLoaded)
+	{
+		Save();
+	}
+}
+
+bool FCoDCDNCache::Load(const FString& Name, int64 InMaxCacheBytes)
+{
+	FWriteScopeLock WriteLock(CacheLock);
+
+	CacheName = Name;
+	CacheDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IWToUE"), TEXT("cdn_cache"));
+
+	InfoFilePath = FPaths::Combine(CacheDir, Name + TEXT(".cdn_info"));
+	DataFilePath = FPaths::Combine(CacheDir, Name + TEXT(".cdn_data"));
+	JournalFilePath = FPaths::Combine(CacheDir, Name + TEXT(".cdn_journal"));
 
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	PlatformFile.CreateDirectory(*CdnDir);
+	PlatformFile.CreateDirectory(*CacheDir);
 
 	bIsLoaded = true;
+	MaxCacheBytes = InMaxCacheBytes;
+	DataGeneration = 0;
+	Entries.Reset();
+
+	// The checkpoint names the current data file, so it has to be read before the data file is sized.
+	LoadCheckpoint();
+	DataFileSize = FMath::Max<int64>(PlatformFile.FileSize(*DataFilePath), 0);
+	const int32 ReplayedRecords = ReplayJournal();
+	DeleteStaleDataFiles();
+
+	// Entries pointing past the end of the data file were journaled but their data never fully landed.
+	int32 DroppedEntries = 0;
+	LiveBytes = 0;
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Offset + It.Value().Size > static_cast<uint64>(DataFileSize))
+		{
+			It.RemoveCurrent();
+			++DroppedEntries;
+			continue;
+		}
+		LiveBytes += It.Value().Size;
+	}
+
+	if (!OpenWriters(false))
+		return false;
 
+	EvictLeastRecentlyUsed();
+	if (ReplayedRecords > 0 || DroppedEntries > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Recovered CDN cache %s: replayed %d journal records, dropped %d entries."), *Name,
+		       ReplayedRecords, DroppedEntries);
+		// Fold the journal into a fresh checkpoint so it starts empty.
+		if (!WriteCheckpoint())
+			return false;
+	}
+	StartCompactionIfNeeded();
+	return true;
+}
+
+bool FCoDCDNCache::LoadCheckpoint()
+{
 	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *InfoFilePath))
+	if (!FFileHelper::LoadFileToArray(FileData, *InfoFilePath, FILEREAD_Silent))
 		return false;
     
 	FMemoryReader Reader(FileData, true);
     
 	uint32 Signature;
 	Reader << Signature;
-	if (Signature != 0x494E4443)
+	if (Signature != CDNInfoSignature)
 		return false;
     
 	uint32 Version;
 	Reader << Version;
-	if (Version != 1)
+	if (Version < 1 || Version > CDNInfoVersion)
 		return false;
     
 	uint32 NumEntries;
 	Reader << NumEntries;
-    
-	for (uint32 i = 0; i < NumEntries; i++)
+	if (Version >= 2)
+	{
+		// Data size at checkpoint time; the actual file size is what bounds entries.
+		uint64 CheckpointDataSize;
+		Reader << CheckpointDataSize;
+	}
+	if (Version >= 3)
+	{
+		FString DataFileName;
+		Reader << DataGeneration;
+		Reader << DataFileName;
+		DataFilePath = FPaths::Combine(CacheDir, DataFileName);
+	}
+
+	const int64 Now = FDateTime::UtcNow().GetTicks();
+	Entries.Reserve(NumEntries);
+	for (uint32 i = 0; i < NumEntries && !Reader.IsError(); i++)
 	{
 		FCoDCDNCacheEntry Entry;
 		Reader << Entry.Hash;
 		Reader << Entry.Offset;
 		Reader << Entry.Size;
+		Entry.LastAccess = Now;
+		Entry.ContentHash = 0;
+		Entry.bVerified = false;
+		if (Version >= 3)
+		{
+			Reader << Entry.LastAccess;
+		}
+		if (Version >= 4)
+		{
+			Reader << Entry.ContentHash;
+		}
 		Entries.Add(Entry.Hash, Entry);
 	}
     
-	return true;
+	return !Reader.IsError();
+}
+
+int32 FCoDCDNCache::ReplayJournal()
+{
+	TArray<uint8> JournalData;
+	if (!FFileHelper::LoadFileToArray(JournalData, *JournalFilePath, FILEREAD_Silent))
+		return 0;
+
+	const int64 Now = FDateTime::UtcNow().GetTicks();
+	int32 ReplayedRecords = 0;
+	int32 SkippedRecords = 0;
+	for (int64 Position = 0; Position + static_cast<int64>(sizeof(FJournalRecord)) <= JournalData.Num();
+	     Position += sizeof(FJournalRecord))
+	{
+		FJournalRecord Record;
+		FMemory::Memcpy(&Record, JournalData.GetData() + Position, sizeof(FJournalRecord));
+		// A torn or zeroed record marks the point where the last session stopped writing.
+		if (Record.Checksum != ComputeRecordChecksum(Record))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("CDN cache journal %s is truncated at record %d."), *JournalFilePath,
+			       ReplayedRecords);
+			break;
+		}
+		// Left over from before a compaction whose checkpoint landed but whose journal was never truncated; the
+		// checkpoint already covers these, and their offsets point into the previous data file.
+		if (Record.Generation != DataGeneration)
+		{
+			++SkippedRecords;
+			continue;
+		}
+		if (Record.Flags & JournalRemoved)
+		{
+			Entries.Remove(Record.Hash);
+		}
+		else
+		{
+			Entries.Add(Record.Hash,
+			            FCoDCDNCacheEntry{Record.Hash, Record.Offset, Record.Size, Now, Record.ContentHash, false});
+		}
+		++ReplayedRecords;
+	}
+	if (SkippedRecords > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Skipped %d CDN cache journal records of a previous data file."), SkippedRecords);
+	}
+	return ReplayedRecords + SkippedRecords;
+}
+
+void FCoDCDNCache::DeleteStaleDataFiles() const
+{
+	// Leftovers of a compaction that never reached its checkpoint, or data files it replaced.
+	TArray<FString> DataFiles;
+	IFileManager::Get().FindFiles(DataFiles, *FPaths::Combine(CacheDir, CacheName + TEXT(".*.cdn_data")), true, false);
+	DataFiles.Add(CacheName + TEXT(".cdn_data"));
+
+	const FString CurrentFileName = FPaths::GetCleanFilename(DataFilePath);
+	for (const FString& DataFile : DataFiles)
+	{
+		if (DataFile != CurrentFileName)
+		{
+			IFileManager::Get().Delete(*FPaths::Combine(CacheDir, DataFile), false, false, true);
+		}
+	}
 }
 
 bool FCoDCDNCache::Save()
+{
+	FWriteScopeLock WriteLock(CacheLock);
+	return WriteCheckpoint();
+}
+
+void FCoDCDNCache::SetMaxCacheSize(int64 InMaxCacheBytes)
+{
+	FWriteScopeLock WriteLock(CacheLock);
+	MaxCacheBytes = InMaxCacheBytes;
+	if (bIsLoaded)
+	{
+		EvictLeastRecentlyUsed();
+		StartCompactionIfNeeded();
+	}
+}
+
+bool FCoDCDNCache::WriteCheckpoint()
 {
 	if (!bIsLoaded)
 		return false;
-    
+
+	// Everything the checkpoint references must be on disk before the journal is dropped.
+	if (DataHandle)
+	{
+		DataHandle->Flush();
+	}
+	if (!SaveCheckpointFile(DataFilePath, DataGeneration, DataFileSize))
+		return false;
+
+	// The old journal's records are all folded into this checkpoint, so replaying them after a crash here only
+	// reapplies what the checkpoint already holds.
+	if (!OpenWriters(true))
+		return false;
+
+	if (AddCount > 0)
+	{
+		const double AddSeconds = FPlatformTime::ToSeconds64(AddCycles);
+		UE_LOG(LogTemp, Log, TEXT("CDN cache checkpoint: %d entries. %llu adds so far at %.0f adds/s, %.1f MB/s."),
+		       Entries.Num(), AddCount, AddSeconds > 0.0 ? AddCount / AddSeconds : 0.0,
+		       AddSeconds > 0.0 ? AddedBytes / AddSeconds / (1024.0 * 1024.0) : 0.0);
+	}
+	if (const uint64 Extracts = ExtractCount.load(std::memory_order_relaxed))
+	{
+		const double ExtractSeconds = FPlatformTime::ToSeconds64(ExtractCycles.load(std::memory_order_relaxed));
+		const double VerifySeconds = FPlatformTime::ToSeconds64(VerifyCycles.load(std::memory_order_relaxed));
+		UE_LOG(LogTemp, Log, TEXT("CDN cache: %llu extracts in %.3f s, checksum verification %.1f%% of that time."),
+		       Extracts, ExtractSeconds, ExtractSeconds > 0.0 ? VerifySeconds / ExtractSeconds * 100.0 : 0.0);
+	}
+	return true;
+}
+
+bool FCoDCDNCache::SaveCheckpointFile(const FString& InDataFilePath, uint32 InDataGeneration,
+                                      int64 InDataFileSize) const
+{
 	TArray<uint8> Data;
 	FMemoryWriter Writer(Data);
     
-	uint32 Signature = 0x494E4443;
-	uint32 Version = 1;
+	uint32 Signature = CDNInfoSignature;
+	uint32 Version = CDNInfoVersion;
 	Writer << Signature;
 	Writer << Version;
     
 	uint32 NumEntries = Entries.Num();
 	Writer << NumEntries;
+	uint64 CheckpointDataSize = InDataFileSize;
+	Writer << CheckpointDataSize;
+	FString DataFileName = FPaths::GetCleanFilename(InDataFilePath);
+	Writer << InDataGeneration;
+	Writer << DataFileName;
     
 	for (auto& EntryPair : Entries)
 	{
@@ -65,68 +295,324 @@ bool FCoDCDNCache::Save()
 		Writer.Serialize((void*)&Entry.Hash, sizeof(Entry.Hash));
 		Writer.Serialize((void*)&Entry.Offset, sizeof(Entry.Offset));
 		Writer.Serialize((void*)&Entry.Size, sizeof(Entry.Size));
+		Writer.Serialize((void*)&Entry.LastAccess, sizeof(Entry.LastAccess));
+		Writer.Serialize((void*)&Entry.ContentHash, sizeof(Entry.ContentHash));
 	}
-    
-	return FFileHelper::SaveArrayToFile(Data, *InfoFilePath);
+
+	// Written under a temporary name so a crash never leaves a half-written checkpoint behind.
+	const FString TempInfoFilePath = InfoFilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Data, *TempInfoFilePath) ||
+		!IFileManager::Get().Move(*InfoFilePath, *TempInfoFilePath, true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write CDN cache checkpoint: %s"), *InfoFilePath);
+		return false;
+	}
+	return true;
 }
 
-bool FCoDCDNCache::Add(const uint64 Hash, const TArray<uint8>& Buffer)
+bool FCoDCDNCache::OpenWriters(bool bTruncateJournal)
 {
-	if (!bIsLoaded)
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!DataHandle)
+	{
+		DataHandle.Reset(PlatformFile.OpenWrite(*DataFilePath, true, true));
+	}
+	if (bTruncateJournal || !JournalHandle)
+	{
+		JournalHandle.Reset();
+		JournalHandle.Reset(PlatformFile.OpenWrite(*JournalFilePath, !bTruncateJournal, false));
+		JournalRecordCount = 0;
+	}
+	if (!DataHandle || !JournalHandle)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open CDN cache files for writing: %s"), *DataFilePath);
 		return false;
+	}
+	return true;
+}
 
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    
-	TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenWrite(*DataFilePath, true, false));
-	if (!FileHandle)
+uint32 FCoDCDNCache::ComputeRecordChecksum(const FJournalRecord& Record)
+{
+	return FCrc::MemCrc32(&Record, STRUCT_OFFSET(FJournalRecord, Checksum));
+}
+
+bool FCoDCDNCache::AppendJournal(uint64 Hash, uint64 Offset, uint64 Size, uint64 ContentHash, uint32 Flags)
+{
+	FJournalRecord Record;
+	Record.Hash = Hash;
+	Record.Generation = DataGeneration;
+	Record.Reserved = 0;
+	Record.Offset = Offset;
+	Record.Size = Size;
+	Record.ContentHash = ContentHash;
+	Record.Flags = Flags;
+	Record.Checksum = ComputeRecordChecksum(Record);
+
+	if (!JournalHandle->Write(reinterpret_cast<const uint8*>(&Record), sizeof(Record)))
+		return false;
+
+	++JournalRecordCount;
+	return true;
+}
+
+bool FCoDCDNCache::Add(const uint64 Hash, const TArray<uint8>& Buffer)
+{
+	FWriteScopeLock WriteLock(CacheLock);
+	if (!bIsLoaded || !DataHandle || !JournalHandle)
 		return false;
 
-	FCoDCDNCacheEntry Entry;
-	Entry.Hash = Hash;
-	Entry.Offset = FileHandle->Tell();
-	Entry.Size = Buffer.Num();
+	if (Entries.Contains(Hash))
+		return true;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-	Entries.Add(Entry.Hash, Entry);
+	const uint64 ContentHash = FXxHash64::HashBuffer(Buffer.GetData(), Buffer.Num()).Hash;
 
-	if (!Save())
+	// Data first, then the journal record, so a recovered record never points at data that was not written.
+	const uint64 Offset = DataFileSize;
+	if (!DataHandle->Write(Buffer.GetData(), Buffer.Num()))
 	{
 		return false;
 	}
+	DataFileSize += Buffer.Num();
 
-	if (!FileHandle->Write(Buffer.GetData(), Buffer.Num()))
+	if (!AppendJournal(Hash, Offset, Buffer.Num(), ContentHash, 0))
 	{
 		return false;
 	}
+	Entries.Add(Hash, FCoDCDNCacheEntry{Hash, Offset, static_cast<uint64>(Buffer.Num()),
+	                                    FDateTime::UtcNow().GetTicks(), ContentHash, false});
+	LiveBytes += Buffer.Num();
 
+	++AddCount;
+	AddedBytes += Buffer.Num();
+	AddCycles += FPlatformTime::Cycles64() - StartCycles;
+
+	EvictLeastRecentlyUsed();
+	if (JournalRecordCount >= CheckpointInterval)
+	{
+		WriteCheckpoint();
+	}
+	StartCompactionIfNeeded();
 	return true;
 }
 
-bool FCoDCDNCache::Extract(uint64 Hash, int32 ExpectedSize, TArray<uint8>& OutBuffer)
+void FCoDCDNCache::EvictLeastRecentlyUsed()
 {
-	if (!bIsLoaded)
-		return false;
+	if (MaxCacheBytes <= 0 || LiveBytes <= MaxCacheBytes)
+		return;
 
-	const FCoDCDNCacheEntry* Entry = Entries.Find(Hash);
-	if (!Entry)
-		return false;
+	// Evict down to 90% of the budget so the next few adds do not each pay for a sort.
+	const int64 TargetBytes = MaxCacheBytes - MaxCacheBytes / 10;
 
-	if (ExpectedSize > 0 && Entry->Size != ExpectedSize)
-		return false;
+	TArray<TPair<int64, uint64>> AccessOrder;
+	AccessOrder.Reserve(Entries.Num());
+	for (const auto& EntryPair : Entries)
+	{
+		AccessOrder.Emplace(EntryPair.Value.LastAccess, EntryPair.Key);
+	}
+	AccessOrder.Sort([](const TPair<int64, uint64>& A, const TPair<int64, uint64>& B) { return A.Key < B.Key; });
 
+	int32 EvictedCount = 0;
+	const int64 StartBytes = LiveBytes;
+	for (const TPair<int64, uint64>& Access : AccessOrder)
+	{
+		if (LiveBytes <= TargetBytes)
+			break;
+
+		const FCoDCDNCacheEntry Entry = Entries.FindAndRemoveChecked(Access.Value);
+		AppendJournal(Entry.Hash, Entry.Offset, Entry.Size, Entry.ContentHash, JournalRemoved);
+		LiveBytes -= Entry.Size;
+		++EvictedCount;
+	}
+	UE_LOG(LogTemp, Log, TEXT("CDN cache evicted %d entries (%.1f MB) to stay under %.1f MB."), EvictedCount,
+	       (StartBytes - LiveBytes) / (1024.0 * 1024.0), MaxCacheBytes / (1024.0 * 1024.0));
+}
+
+void FCoDCDNCache::StartCompactionIfNeeded()
+{
+	const int64 DeadBytes = DataFileSize - LiveBytes;
+	if (bIsCompacting || DeadBytes < MinCompactionBytes || DeadBytes * 2 < DataFileSize)
+		return;
+
+	TArray<FCoDCDNCacheEntry> LiveEntries;
+	Entries.GenerateValueArray(LiveEntries);
+	// Sequential reads of the source file.
+	LiveEntries.Sort([](const FCoDCDNCacheEntry& A, const FCoDCDNCacheEntry& B) { return A.Offset < B.Offset; });
+
+	const FString TargetPath = FPaths::Combine(
+		CacheDir, FString::Printf(TEXT("%s.%u.cdn_data"), *CacheName, DataGeneration + 1));
+
+	// Any previous task has already finished, since it clears bIsCompacting as its last step.
+	bIsCompacting = true;
+	CompactionTask = Async(EAsyncExecution::ThreadPool,
+	                       [this, LiveEntries = MoveTemp(LiveEntries), SourcePath = DataFilePath, TargetPath]() mutable
+	                       {
+		                       RunCompaction(MoveTemp(LiveEntries), MoveTemp(SourcePath), MoveTemp(TargetPath));
+	                       });
+}
+
+void FCoDCDNCache::RunCompaction(TArray<FCoDCDNCacheEntry> LiveEntries, FString SourcePath, FString TargetPath)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*DataFilePath));
-	if (!FileHandle)
-		return false;
 
-	if (!FileHandle->Seek(Entry->Offset))
-		return false;
+	TUniquePtr<IFileHandle> SourceHandle(PlatformFile.OpenRead(*SourcePath, true));
+	TUniquePtr<IFileHandle> TargetHandle(PlatformFile.OpenWrite(*TargetPath, false, true));
+	auto Abort = [&]()
+	{
+		TargetHandle.Reset();
+		PlatformFile.DeleteFile(*TargetPath);
+		FWriteScopeLock WriteLock(CacheLock);
+		bIsCompacting = false;
+	};
+	if (!SourceHandle || !TargetHandle)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open CDN cache files for compaction: %s"), *TargetPath);
+		Abort();
+		return;
+	}
 
-	OutBuffer.SetNumUninitialized(Entry->Size);
-    
-	if (!FileHandle->Read(OutBuffer.GetData(), Entry->Size))
+	// Copy the snapshot without holding the lock; adds, evictions and lookups carry on against the old file.
+	TArray<uint8> ScratchBuffer;
+	TMap<uint64, TPair<uint64, uint64>> Relocated;
+	Relocated.Reserve(LiveEntries.Num());
+	int64 TargetSize = 0;
+	for (const FCoDCDNCacheEntry& Entry : LiveEntries)
 	{
-		OutBuffer.Empty();
-		return false;
+		if (!CopyFileRange(*SourceHandle, *TargetHandle, Entry.Offset, Entry.Size, ScratchBuffer))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to copy CDN cache entry %016llx during compaction."), Entry.Hash);
+			Abort();
+			return;
+		}
+		Relocated.Add(Entry.Hash, TPair<uint64, uint64>(Entry.Offset, TargetSize));
+		TargetSize += Entry.Size;
 	}
-	return true;
+
+	FWriteScopeLock WriteLock(CacheLock);
+	auto AbortLocked = [&]()
+	{
+		TargetHandle.Reset();
+		PlatformFile.DeleteFile(*TargetPath);
+		bIsCompacting = false;
+	};
+
+	// Objects added while copying are still only in the old file; they are few, so copy them under the lock.
+	// Offsets are only applied once everything has been copied, so a failure leaves the index untouched.
+	DataHandle->Flush();
+	TArray<TPair<FCoDCDNCacheEntry*, uint64>> NewOffsets;
+	NewOffsets.Reserve(Entries.Num());
+	for (auto& EntryPair : Entries)
+	{
+		FCoDCDNCacheEntry& Entry = EntryPair.Value;
+		const TPair<uint64, uint64>* Moved = Relocated.Find(Entry.Hash);
+		if (Moved && Moved->Key == Entry.Offset)
+		{
+			NewOffsets.Emplace(&Entry, Moved->Value);
+			continue;
+		}
+		if (!CopyFileRange(*SourceHandle, *TargetHandle, Entry.Offset, Entry.Size, ScratchBuffer))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to copy CDN cache entry %016llx during compaction."), Entry.Hash);
+			AbortLocked();
+			return;
+		}
+		NewOffsets.Emplace(&Entry, TargetSize);
+		TargetSize += Entry.Size;
+	}
+	TargetHandle->Flush();
+
+	// The checkpoint names the new data file, which makes the swap atomic on disk. The cache only switches files
+	// once it is written; until then adds keep going to the old file the on-disk state still describes.
+	for (TPair<FCoDCDNCacheEntry*, uint64>& NewOffset : NewOffsets)
+	{
+		Swap(NewOffset.Key->Offset, NewOffset.Value);
+	}
+	if (!SaveCheckpointFile(TargetPath, DataGeneration + 1, TargetSize))
+	{
+		for (TPair<FCoDCDNCacheEntry*, uint64>& NewOffset : NewOffsets)
+		{
+			Swap(NewOffset.Key->Offset, NewOffset.Value);
+		}
+		AbortLocked();
+		return;
+	}
+
+	const int64 OldDataFileSize = DataFileSize;
+	DataHandle = MoveTemp(TargetHandle);
+	DataFilePath = TargetPath;
+	DataFileSize = TargetSize;
+	++DataGeneration;
+	// Starts the journal for the new generation; a crash before this leaves old-generation records that replay skips.
+	OpenWriters(true);
+
+	SourceHandle.Reset();
+	FFileHandlePool::Get().Release(SourcePath);
+	PlatformFile.DeleteFile(*SourcePath);
+	bIsCompacting = false;
+
+	UE_LOG(LogTemp, Log, TEXT("Compacted CDN cache %s: %.1f MB -> %.1f MB in %.2f s."), *CacheName,
+	       OldDataFileSize / (1024.0 * 1024.0), DataFileSize / (1024.0 * 1024.0),
+	       FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+bool FCoDCDNCache::Extract(uint64 Hash, int32 ExpectedSize, TArray<uint8>& OutBuffer)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	uint64 CorruptOffset;
+	{
+		// The read stays under the shared lock so compaction cannot swap the data file underneath it.
+		FReadScopeLock ReadLock(CacheLock);
+		if (!bIsLoaded)
+			return false;
+
+		FCoDCDNCacheEntry* Entry = Entries.Find(Hash);
+		if (!Entry)
+			return false;
+
+		if (ExpectedSize > 0 && Entry->Size != ExpectedSize)
+			return false;
+
+		OutBuffer.SetNumUninitialized(Entry->Size);
+
+		bool bIntact = FFileHandlePool::Get().ReadAt(DataFilePath, Entry->Offset, OutBuffer.GetData(), Entry->Size);
+		if (bIntact && Entry->ContentHash != 0 && !FPlatformAtomics::AtomicRead_Relaxed(&Entry->bVerified))
+		{
+			const uint64 VerifyStartCycles = FPlatformTime::Cycles64();
+			bIntact = FXxHash64::HashBuffer(OutBuffer.GetData(), OutBuffer.Num()).Hash == Entry->ContentHash;
+			VerifyCycles.fetch_add(FPlatformTime::Cycles64() - VerifyStartCycles, std::memory_order_relaxed);
+			if (bIntact)
+			{
+				FPlatformAtomics::AtomicStore_Relaxed(&Entry->bVerified, static_cast<int8>(true));
+			}
+		}
+
+		if (bIntact)
+		{
+			// Concurrent readers may race on this store; any of their timestamps is good enough for LRU.
+			FPlatformAtomics::AtomicStore_Relaxed(&Entry->LastAccess, FDateTime::UtcNow().GetTicks());
+			ExtractCount.fetch_add(1, std::memory_order_relaxed);
+			ExtractCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+			return true;
+		}
+		CorruptOffset = Entry->Offset;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("CDN cache entry %016llx is corrupt, evicting it."), Hash);
+	OutBuffer.Empty();
+	EvictCorruptEntry(Hash, CorruptOffset);
+	return false;
+}
+
+void FCoDCDNCache::EvictCorruptEntry(uint64 Hash, uint64 Offset)
+{
+	FWriteScopeLock WriteLock(CacheLock);
+	const FCoDCDNCacheEntry* Entry = Entries.Find(Hash);
+	if (!Entry || Entry->Offset != Offset)
+		return;
+
+	AppendJournal(Entry->Hash, Entry->Offset, Entry->Size, Entry->ContentHash, JournalRemoved);
+	LiveBytes -= Entry->Size;
+	Entries.Remove(Hash);
 }
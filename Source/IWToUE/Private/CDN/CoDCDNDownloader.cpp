@@ -2,23 +2,20 @@
 
 void FCoDCDNDownloader::AddFiled(const uint64 CacheID)
 {
-	FailedAttempts.Add(CacheID, FDateTime::UtcNow());
+	FailedObjects.RecordFailure(CacheID);
 }
 
-bool FCoDCDNDownloader::HasFailed(const uint64 CacheID)
+void FCoDCDNDownloader::AddTransientFailure(const uint64 CacheID)
 {
-	const FDateTime* FoundTime = FailedAttempts.Find(CacheID);
-
-	if (FoundTime != nullptr)
-	{
-		FTimespan TimePassed = FDateTime::UtcNow() - *FoundTime;
+	FailedObjects.RecordTransientFailure(CacheID);
+}
 
-		if (TimePassed.GetTotalSeconds() <= 60.0)
-		{
-			return true;
-		}
-		FailedAttempts.Remove(CacheID);
-	}
+bool FCoDCDNDownloader::HasFailed(const uint64 CacheID)
+{
+	return FailedObjects.ShouldSkip(CacheID);
+}
 
-	return false;
+void FCoDCDNDownloader::ClearFailed(const uint64 CacheID)
+{
+	FailedObjects.RecordSuccess(CacheID);
 }
@@ -1,5 +1,6 @@
 ﻿#include "CDN/CoDCDNDownloaderV2.h"
 
+#include "CDN/CoDCDNFetchScheduler.h"
 #include "CDN/WebClientFactory.h"
 #include "CDN/XSubCacheV2.h"
 #include "CDN/XSubCacheV3.h"
@@ -10,6 +11,7 @@ bool FCoDCDNDownloaderV2::Initialize(const FString& GameDirectory)
 	if (bIsInitialized) return true;
 
 	Client = FWebClientFactory::Create();
+	FetchScheduler = MakeShared<FCoDCDNFetchScheduler, ESPMode::ThreadSafe>(Client, MaxConcurrentFetches);
 
 	TSharedPtr<FDownloadMemoryResult> Result = Client->DownloadData(CoDV2CDNURL);
 	if (!Result.IsValid())
@@ -26,18 +28,20 @@ bool FCoDCDNDownloaderV2::Initialize(const FString& GameDirectory)
 	}
 
 	Cache.Load("CoDCDNV2");
+	FailedObjects.Load("CoDCDNV2");
 
 	return bIsInitialized = true;
 }
 
 int32 FCoDCDNDownloaderV2::ExtractCDNObject(TArray<uint8>& Buffer, uint64 CacheID, int32 BufferSize)
 {
-	if (!Entries.Contains(CacheID))
+	// Entries is only written during Initialize; the caches do their own locking.
+	const FCoDCDNDownloaderV2Entry* Found = Entries.Find(CacheID);
+	if (!Found)
 	{
 		return 0;
 	}
-	FCoDCDNDownloaderV2Entry Entry = Entries[CacheID];
-	FRWScopeLock WriteLock(CDNLock, SLT_Write);
+	const FCoDCDNDownloaderV2Entry Entry = *Found;
 
 	TArray<uint8> CDNBuffer;
 	Cache.Extract(CacheID, Entry.Size, CDNBuffer);
@@ -49,6 +53,7 @@ int32 FCoDCDNDownloaderV2::ExtractCDNObject(TArray<uint8>& Buffer, uint64 CacheI
 		}
 	}
 
+	// Checked before anything is queued, so objects known to be missing cost no network round trip.
 	if (HasFailed(CacheID))
 	{
 		return 0;
@@ -56,12 +61,24 @@ int32 FCoDCDNDownloaderV2::ExtractCDNObject(TArray<uint8>& Buffer, uint64 CacheI
 
 	FString URL = FString::Printf(TEXT("%s/23/%02x/%016llx_%08llx_%s"), *CoDV2CDNURL, static_cast<uint8>(Entry.Hash),
 	                              Entry.Hash, Entry.Size, Entry.Flags ? TEXT("1") : TEXT("0"));
-	TSharedPtr<FDownloadMemoryResult> Result = Client->DownloadData(URL);
-	if (Result->DataBuffer.IsEmpty() || Result->DataBuffer.Num() != Entry.Size)
-	{
-		AddFiled(CacheID);
+	// Misses for the same object share one download; the result buffer is only read from here on.
+	TSharedPtr<FDownloadMemoryResult> Result = FCoDCDNFetchScheduler::Wait(FetchScheduler->Fetch(CacheID, URL));
+	if (!Result.IsValid() || Result->DataBuffer.IsEmpty() || Result->DataBuffer.Num() != Entry.Size)
+	{
+		// Only a 404, or a successful response with the wrong size, says the object is really missing. Timeouts,
+		// connection errors and server errors are retried shortly instead of being persisted.
+		const bool bDefinitiveMiss = Result.IsValid() && (Result->ResponseCode == 404 || Result->IsSuccessful());
+		if (bDefinitiveMiss)
+		{
+			AddFiled(CacheID);
+		}
+		else
+		{
+			AddTransientFailure(CacheID);
+		}
 		return 0;
 	}
+	ClearFailed(CacheID);
 	Cache.Add(CacheID, Result->DataBuffer);
 
 	if (FXSubCacheV2::DecompressPackageObject(Entry.Hash, Result->DataBuffer, BufferSize, Buffer))
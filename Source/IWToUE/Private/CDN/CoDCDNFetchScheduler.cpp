@@ -0,0 +1,104 @@
+﻿#include "CDN/CoDCDNFetchScheduler.h"
+
+#include "HttpManager.h"
+#include "HttpModule.h"
+
+FCoDCDNFetchScheduler::FCoDCDNFetchScheduler(TSharedPtr<IWebClient> InClient, int32 InMaxConcurrentFetches)
+	: Client(MoveTemp(InClient)), MaxConcurrentFetches(FMath::Max(InMaxConcurrentFetches, 1))
+{
+}
+
+FCoDCDNFetchScheduler::~FCoDCDNFetchScheduler()
+{
+	// Queued fetches never started; release their waiters. Running ones resolve through their own callbacks.
+	TSharedPtr<FFetch> Fetch;
+	while (Pending.Dequeue(Fetch))
+	{
+		Fetch->Promise.SetValue(nullptr);
+	}
+	UE_LOG(LogTemp, Log, TEXT("CDN fetches: %llu downloads started, %llu requests joined one in flight, peak %d concurrent."),
+	       StartedFetches, JoinedFetches, PeakActiveFetches);
+}
+
+TSharedFuture<FCoDCDNFetchScheduler::FFetchResult> FCoDCDNFetchScheduler::Fetch(uint64 Key, const FString& Url)
+{
+	TSharedPtr<FFetch> NewFetch;
+	TSharedFuture<FFetchResult> Future;
+	{
+		FScopeLock Lock(&FetchLock);
+		if (const TSharedFuture<FFetchResult>* Existing = InFlight.Find(Key))
+		{
+			++JoinedFetches;
+			return *Existing;
+		}
+
+		NewFetch = MakeShared<FFetch>();
+		NewFetch->Key = Key;
+		NewFetch->Url = Url;
+		Future = NewFetch->Promise.GetFuture().Share();
+		InFlight.Add(Key, Future);
+
+		if (ActiveFetches >= MaxConcurrentFetches)
+		{
+			Pending.Enqueue(NewFetch);
+			return Future;
+		}
+		++ActiveFetches;
+		PeakActiveFetches = FMath::Max(PeakActiveFetches, ActiveFetches);
+	}
+
+	Start(NewFetch);
+	return Future;
+}
+
+FCoDCDNFetchScheduler::FFetchResult FCoDCDNFetchScheduler::Wait(const TSharedFuture<FFetchResult>& Future)
+{
+	while (!Future.WaitFor(FTimespan::FromMilliseconds(10)))
+	{
+		if (IsInGameThread())
+		{
+			FHttpModule::Get().GetHttpManager().Tick(0.01f);
+		}
+	}
+	return Future.Get();
+}
+
+void FCoDCDNFetchScheduler::Start(const TSharedPtr<FFetch>& Fetch)
+{
+	{
+		FScopeLock Lock(&FetchLock);
+		++StartedFetches;
+	}
+
+	TWeakPtr<FCoDCDNFetchScheduler, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Client->DownloadData(Fetch->Url, [WeakThis, Fetch](FFetchResult Result)
+	{
+		if (TSharedPtr<FCoDCDNFetchScheduler, ESPMode::ThreadSafe> Scheduler = WeakThis.Pin())
+		{
+			Scheduler->OnFetchComplete(Fetch, MoveTemp(Result));
+		}
+		else
+		{
+			Fetch->Promise.SetValue(MoveTemp(Result));
+		}
+	});
+}
+
+void FCoDCDNFetchScheduler::OnFetchComplete(const TSharedPtr<FFetch>& Fetch, FFetchResult Result)
+{
+	TSharedPtr<FFetch> Next;
+	{
+		FScopeLock Lock(&FetchLock);
+		InFlight.Remove(Fetch->Key);
+		if (!Pending.Dequeue(Next))
+		{
+			--ActiveFetches;
+		}
+	}
+
+	Fetch->Promise.SetValue(MoveTemp(Result));
+	if (Next)
+	{
+		Start(Next);
+	}
+}
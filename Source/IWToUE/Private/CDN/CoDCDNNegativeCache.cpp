@@ -0,0 +1,196 @@
+﻿#include "CDN/CoDCDNNegativeCache.h"
+
+namespace
+{
+	constexpr uint32 NegativeCacheSignature = 0x4D4E4443;
+	constexpr uint32 NegativeCacheVersion = 1;
+}
+
+FCoDCDNNegativeCache::~FCoDCDNNegativeCache()
+{
+	if (bIsLoaded)
+	{
+		Save();
+		UE_LOG(LogTemp, Log, TEXT("CDN negative cache: %d objects backing off, %llu requests skipped this session."),
+		       Entries.Num(), SkippedRequests.load(std::memory_order_relaxed));
+	}
+}
+
+bool FCoDCDNNegativeCache::Load(const FString& Name, const FPolicy& InPolicy)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	const FString CdnDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IWToUE"), TEXT("cdn_cache"));
+	FilePath = FPaths::Combine(CdnDir, Name + TEXT(".cdn_misses"));
+	FPlatformFileManager::Get().GetPlatformFile().CreateDirectory(*CdnDir);
+
+	Policy = InPolicy;
+	Entries.Reset();
+	TransientEntries.Reset();
+	bIsLoaded = true;
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath, FILEREAD_Silent))
+		return false;
+
+	FMemoryReader Reader(FileData, true);
+
+	uint32 Signature;
+	uint32 Version;
+	Reader << Signature;
+	Reader << Version;
+	if (Signature != NegativeCacheSignature || Version != NegativeCacheVersion)
+		return false;
+
+	uint32 NumEntries;
+	Reader << NumEntries;
+
+	// Entries past their TTL are dropped here rather than carried forward.
+	const int64 ExpiredBefore = (FDateTime::UtcNow() - Policy.TimeToLive).GetTicks();
+	Entries.Reserve(NumEntries);
+	for (uint32 i = 0; i < NumEntries && !Reader.IsError(); i++)
+	{
+		uint64 Key;
+		FEntry Entry;
+		Reader << Key;
+		Reader << Entry.FirstFailureTicks;
+		Reader << Entry.RetryAfterTicks;
+		Reader << Entry.FailureCount;
+		if (Entry.FirstFailureTicks >= ExpiredBefore)
+		{
+			Entries.Add(Key, Entry);
+		}
+	}
+
+	return !Reader.IsError();
+}
+
+bool FCoDCDNNegativeCache::Save()
+{
+	FWriteScopeLock WriteLock(Lock);
+	return SaveLocked();
+}
+
+bool FCoDCDNNegativeCache::SaveLocked()
+{
+	if (!bIsLoaded)
+		return false;
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Signature = NegativeCacheSignature;
+	uint32 Version = NegativeCacheVersion;
+	Writer << Signature;
+	Writer << Version;
+
+	uint32 NumEntries = Entries.Num();
+	Writer << NumEntries;
+	for (auto& EntryPair : Entries)
+	{
+		Writer << EntryPair.Key;
+		Writer << EntryPair.Value.FirstFailureTicks;
+		Writer << EntryPair.Value.RetryAfterTicks;
+		Writer << EntryPair.Value.FailureCount;
+	}
+
+	UnsavedChanges = 0;
+	const FString TempFilePath = FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Data, *TempFilePath) || !IFileManager::Get().Move(*FilePath, *TempFilePath, true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to save CDN negative cache: %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FCoDCDNNegativeCache::ShouldSkip(uint64 Key)
+{
+	const int64 Now = FDateTime::UtcNow().GetTicks();
+	{
+		FReadScopeLock ReadLock(Lock);
+		const int64* TransientRetryAfter = TransientEntries.Find(Key);
+		if (TransientRetryAfter && Now < *TransientRetryAfter)
+		{
+			SkippedRequests.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+		const FEntry* Entry = Entries.Find(Key);
+		if (!Entry)
+			return false;
+
+		if (Now < Entry->RetryAfterTicks)
+		{
+			SkippedRequests.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+		if (Now - Entry->FirstFailureTicks < Policy.TimeToLive.GetTicks())
+			return false;
+	}
+
+	// Past its TTL: forget the failure history so the next failure starts again at the initial backoff.
+	FWriteScopeLock WriteLock(Lock);
+	Entries.Remove(Key);
+	return false;
+}
+
+void FCoDCDNNegativeCache::RecordFailure(uint64 Key)
+{
+	const FDateTime Now = FDateTime::UtcNow();
+
+	FWriteScopeLock WriteLock(Lock);
+	FEntry* Entry = Entries.Find(Key);
+	if (!Entry)
+	{
+		Entry = &Entries.Add(Key, FEntry{Now.GetTicks(), 0, 0});
+	}
+	else if (Now.GetTicks() < Entry->RetryAfterTicks)
+	{
+		// Another waiter on the same shared download already recorded this failure.
+		return;
+	}
+	++Entry->FailureCount;
+	Entry->RetryAfterTicks = (Now + ComputeBackoff(Key, Entry->FailureCount)).GetTicks();
+
+	if (++UnsavedChanges >= SaveInterval)
+	{
+		SaveLocked();
+	}
+}
+
+void FCoDCDNNegativeCache::RecordTransientFailure(uint64 Key)
+{
+	const int64 RetryAfter = (FDateTime::UtcNow() + Policy.TransientBackoff).GetTicks();
+
+	FWriteScopeLock WriteLock(Lock);
+	TransientEntries.Add(Key, RetryAfter);
+}
+
+void FCoDCDNNegativeCache::RecordSuccess(uint64 Key)
+{
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (!Entries.Contains(Key) && !TransientEntries.Contains(Key))
+			return;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	TransientEntries.Remove(Key);
+	if (Entries.Remove(Key) > 0)
+	{
+		++UnsavedChanges;
+	}
+}
+
+FTimespan FCoDCDNNegativeCache::ComputeBackoff(uint64 Key, uint32 FailureCount) const
+{
+	// Capped before shifting so repeated failures cannot overflow.
+	const int32 Doublings = FMath::Min<uint32>(FailureCount - 1, 30);
+	const double BaseSeconds = FMath::Min(Policy.InitialBackoff.GetTotalSeconds() * static_cast<double>(1ll << Doublings),
+	                                      Policy.MaxBackoff.GetTotalSeconds());
+
+	// Keyed jitter spreads out retries of objects that failed together, e.g. during an outage.
+	const FRandomStream Random(static_cast<int32>(GetTypeHash(Key) ^ FPlatformTime::Cycles()));
+	const double Jitter = Random.FRandRange(1.0f - Policy.JitterFraction, 1.0f + Policy.JitterFraction);
+	return FTimespan::FromSeconds(BaseSeconds * Jitter);
+}
@@ -48,6 +48,7 @@ void FUEWebClient::HandleAsyncResponse(FHttpRequestPtr Request, FHttpResponsePtr
 	{
 		Result = MakeShared<FDownloadMemoryResult>();
 		Result->DataBuffer.Append(Response->GetContent().GetData(), Response->GetContent().Num());
+		Result->ResponseCode = Response->GetResponseCode();
 	}
 
 	if (IsInGameThread())
@@ -3,7 +3,7 @@
 #include "Compression/OodleDataCompressionUtil.h"
 #include "Runtime/OodleDataCompression/Sdks/2.9.11/include/oodle2.h"
 
-bool FXSubCacheV2::DecompressPackageObject(uint64 CacheID, TArray<uint8>& Buffer, int32 DecompressedSize,
+bool FXSubCacheV2::DecompressPackageObject(uint64 CacheID, const TArray<uint8>& Buffer, int32 DecompressedSize,
                                            TArray<uint8>& OutBuffer)
 {
 	if (DecompressedSize == 0)
@@ -41,17 +41,22 @@ bool FXSubCacheV2::DecompressPackageObject(uint64 CacheID, TArray<uint8>& Buffer
 			break;
 		}
 
-		TArray<FVGXSubBlock> Blocks;
+		TArray<FVGXSubBlock, TInlineAllocator<16>> Blocks;
 		Blocks.SetNum(BlockCount);
 		Reader.Serialize(Blocks.GetData(), BlockCount * sizeof(FVGXSubBlock));
 
 		for (uint32 i = 0; i < BlockCount; i++)
 		{
-			Reader.Seek(BlockPosition + Blocks[i].BlockOffset);
-
-			TArray<uint8> CompressedData;
-			CompressedData.SetNumUninitialized(Blocks[i].CompressedSize);
-			Reader.Serialize(CompressedData.GetData(), Blocks[i].CompressedSize);
+			// Blocks are decoded straight out of the input buffer rather than copied out first.
+			const int64 DataOffset = BlockPosition + Blocks[i].BlockOffset;
+			if (DataOffset + Blocks[i].CompressedSize > Buffer.Num() ||
+				static_cast<uint64>(Blocks[i].DecompressedOffset) + Blocks[i].DecompressedSize > static_cast<uint64>(
+					DecompressedSize))
+			{
+				return false;
+			}
+			Reader.Seek(DataOffset + Blocks[i].CompressedSize);
+			const uint8* CompressedData = Buffer.GetData() + DataOffset;
 
 			switch (Blocks[i].Compression)
 			{
@@ -61,7 +66,7 @@ bool FXSubCacheV2::DecompressPackageObject(uint64 CacheID, TArray<uint8>& Buffer
 						NAME_LZ4,
 						OutBuffer.GetData() + Blocks[i].DecompressedOffset,
 						Blocks[i].DecompressedSize,
-						CompressedData.GetData(),
+						CompressedData,
 						Blocks[i].CompressedSize
 					);
 				}
@@ -69,7 +74,7 @@ bool FXSubCacheV2::DecompressPackageObject(uint64 CacheID, TArray<uint8>& Buffer
 			case 0x6:
 				{
 					OodleLZ_Decompress(
-						CompressedData.GetData(),
+						CompressedData,
 						Blocks[i].CompressedSize,
 						OutBuffer.GetData() + Blocks[i].DecompressedOffset,
 						Blocks[i].DecompressedSize,
@@ -90,7 +95,7 @@ bool FXSubCacheV2::DecompressPackageObject(uint64 CacheID, TArray<uint8>& Buffer
 				{
 					FMemory::Memcpy(
 						OutBuffer.GetData() + Blocks[i].DecompressedOffset,
-						CompressedData.GetData(),
+						CompressedData,
 						Blocks[i].CompressedSize
 					);
 				}
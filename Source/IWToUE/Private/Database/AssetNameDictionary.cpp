@@ -0,0 +1,289 @@
+﻿#include "Database/AssetNameDictionary.h"
+
+#include "SeLogChannels.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+FAssetNameDictionary::~FAssetNameDictionary()
+{
+	delete MappedRegion;
+	delete MappedFile;
+}
+
+TUniquePtr<FAssetNameDictionary> FAssetNameDictionary::Open(const FString& FilePath)
+{
+	TUniquePtr<FAssetNameDictionary> Dictionary(new FAssetNameDictionary());
+	Dictionary->MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath);
+	if (!Dictionary->MappedFile) return nullptr;
+	Dictionary->MappedRegion = Dictionary->MappedFile->MapRegion();
+	if (!Dictionary->MappedRegion || Dictionary->MappedRegion->GetMappedSize() < static_cast<int64>(sizeof(FHeader)))
+	{
+		return nullptr;
+	}
+
+	const uint8* Base = Dictionary->MappedRegion->GetMappedPtr();
+	const uint64 MappedSize = Dictionary->MappedRegion->GetMappedSize();
+	FHeader Header;
+	FMemory::Memcpy(&Header, Base, sizeof(FHeader));
+	// Bound each count by the mapped size first so the expected size below cannot overflow. Names are read back
+	// with int32 lengths, so the blob must also fit in one.
+	const bool bCountsValid = Header.EntryCount < MappedSize / (sizeof(uint64) + sizeof(uint32)) &&
+		Header.BlobSize <= MappedSize && Header.BlobSize <= MAX_int32;
+	if (Header.Magic != FHeader::DictionaryMagic || Header.Version != FHeader::DictionaryVersion || !bCountsValid ||
+		MappedSize < sizeof(FHeader) + Header.EntryCount * sizeof(uint64) + (Header.EntryCount + 1) * sizeof(uint32) +
+		Header.BlobSize)
+	{
+		UE_LOG(LogITUDatabase, Warning, TEXT("Ignoring invalid asset name dictionary: %s"), *FilePath);
+		return nullptr;
+	}
+
+	Dictionary->EntryCount = Header.EntryCount;
+	Dictionary->Hashes = reinterpret_cast<const uint64*>(Base + sizeof(FHeader));
+	Dictionary->Offsets = reinterpret_cast<const uint32*>(Dictionary->Hashes + Header.EntryCount);
+	Dictionary->Blob = reinterpret_cast<const ANSICHAR*>(Dictionary->Offsets + Header.EntryCount + 1);
+
+	// Find binary-searches the hashes and slices the blob between adjacent offsets without bounds checks, so both
+	// tables are checked once here.
+	bool bTablesValid = Dictionary->Offsets[0] == 0 && Dictionary->Offsets[Header.EntryCount] == Header.BlobSize;
+	for (int64 Index = 0; bTablesValid && Index < Dictionary->EntryCount; ++Index)
+	{
+		bTablesValid = Dictionary->Offsets[Index] <= Dictionary->Offsets[Index + 1] &&
+			(Index == 0 || Dictionary->Hashes[Index - 1] < Dictionary->Hashes[Index]);
+	}
+	if (!bTablesValid)
+	{
+		UE_LOG(LogITUDatabase, Warning, TEXT("Ignoring asset name dictionary with a corrupt hash or offset table: %s"),
+		       *FilePath);
+		return nullptr;
+	}
+	return Dictionary;
+}
+
+int64 FAssetNameDictionary::FindIndex(uint64 Hash) const
+{
+	return Algo::BinarySearch(TArrayView64<const uint64>(Hashes, EntryCount), Hash & 0xFFFFFFFFFFFFFFF);
+}
+
+TOptional<FString> FAssetNameDictionary::Find(uint64 Hash) const
+{
+	const int64 Index = FindIndex(Hash);
+	if (Index == INDEX_NONE) return TOptional<FString>();
+	return FString(static_cast<int32>(Offsets[Index + 1] - Offsets[Index]), Blob + Offsets[Index]);
+}
+
+TArray<TPair<int32, FString>> FAssetNameDictionary::FindGenerationFiles(const FString& BasePath)
+{
+	const FString Directory = FPaths::GetPath(BasePath);
+	const FString Prefix = FPaths::GetBaseFilename(BasePath) + TEXT(".");
+	const FString Extension = FPaths::GetExtension(BasePath, true);
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(Directory / (Prefix + TEXT("*") + Extension)), true, false);
+
+	TArray<TPair<int32, FString>> Generations;
+	for (const FString& FileName : FileNames)
+	{
+		const FString GenerationText = FileName.Mid(Prefix.Len(), FileName.Len() - Prefix.Len() - Extension.Len());
+		if (GenerationText.IsEmpty() || !GenerationText.IsNumeric()) continue;
+		Generations.Emplace(FCString::Atoi(*GenerationText), Directory / FileName);
+	}
+	Generations.Sort([](const TPair<int32, FString>& A, const TPair<int32, FString>& B)
+	{
+		return A.Key < B.Key;
+	});
+	return Generations;
+}
+
+FString FAssetNameDictionary::FindLatestFile(const FString& BasePath)
+{
+	const TArray<TPair<int32, FString>> Generations = FindGenerationFiles(BasePath);
+	return Generations.Num() > 0 ? Generations.Last().Value : FString();
+}
+
+bool FAssetNameDictionary::Build(const TArray<FString>& WniFiles, const FString& BasePath)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const TArray<TPair<int32, FString>> OldGenerations = FindGenerationFiles(BasePath);
+	const int32 Generation = OldGenerations.Num() > 0 ? OldGenerations.Last().Key + 1 : 1;
+	const FString OutFilePath = FPaths::GetPath(BasePath) / FString::Printf(
+		TEXT("%s.%d%s"), *FPaths::GetBaseFilename(BasePath), Generation, *FPaths::GetExtension(BasePath, true));
+
+	struct FEntry
+	{
+		uint64 Hash;
+		int32 Order;
+		uint32 Offset;
+		int32 Length;
+	};
+	TArray<FEntry> Entries;
+	TArray<ANSICHAR> Names;
+	for (const FString& WniFile : WniFiles)
+	{
+		ParseWniFile(WniFile, [&Entries, &Names](uint64 Hash, const ANSICHAR* Name, int32 Length)
+		{
+			Entries.Add({Hash, Entries.Num(), static_cast<uint32>(Names.Num()), Length});
+			Names.Append(Name, Length);
+		});
+	}
+
+	// Sort by hash and keep the last occurrence of each, matching the old TMap::Append semantics.
+	Entries.Sort([](const FEntry& A, const FEntry& B)
+	{
+		return A.Hash != B.Hash ? A.Hash < B.Hash : A.Order < B.Order;
+	});
+	TArray<uint64> Hashes;
+	TArray<uint32> Offsets;
+	TArray<ANSICHAR> Blob;
+	Hashes.Reserve(Entries.Num());
+	Offsets.Reserve(Entries.Num() + 1);
+	Blob.Reserve(Names.Num());
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		if (Index + 1 < Entries.Num() && Entries[Index + 1].Hash == Entries[Index].Hash) continue;
+		const FEntry& Entry = Entries[Index];
+		Hashes.Add(Entry.Hash);
+		Offsets.Add(Blob.Num());
+		Blob.Append(Names.GetData() + Entry.Offset, Entry.Length);
+	}
+	Offsets.Add(Blob.Num());
+
+	const FString TempFilePath = OutFilePath + TEXT(".tmp");
+	{
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilePath));
+		if (!Writer)
+		{
+			UE_LOG(LogITUDatabase, Error, TEXT("Failed to create asset name dictionary: %s"), *TempFilePath);
+			return false;
+		}
+		FHeader Header;
+		Header.EntryCount = Hashes.Num();
+		Header.BlobSize = Blob.Num();
+		Writer->Serialize(&Header, sizeof(Header));
+		Writer->Serialize(Hashes.GetData(), Hashes.Num() * sizeof(uint64));
+		Writer->Serialize(Offsets.GetData(), Offsets.Num() * sizeof(uint32));
+		Writer->Serialize(Blob.GetData(), Blob.Num());
+		if (!Writer->Close())
+		{
+			IFileManager::Get().Delete(*TempFilePath);
+			return false;
+		}
+	}
+	// Written under a temporary name so a reader never maps a half-written dictionary.
+	if (!IFileManager::Get().Move(*OutFilePath, *TempFilePath, true))
+	{
+		UE_LOG(LogITUDatabase, Error, TEXT("Failed to replace asset name dictionary: %s"), *OutFilePath);
+		return false;
+	}
+	// Also drops the unversioned file earlier builds wrote. A generation still mapped by this process cannot be
+	// deleted on Windows; it is retried after the next build.
+	for (const TPair<int32, FString>& OldGeneration : OldGenerations)
+	{
+		IFileManager::Get().Delete(*OldGeneration.Value, false, false, true);
+	}
+	IFileManager::Get().Delete(*BasePath, false, false, true);
+
+	UE_LOG(LogITUDatabase, Log, TEXT("Built asset name dictionary from %d WNI files: %d names, %.1f MB, %.2f ms."),
+	       WniFiles.Num(), Hashes.Num(),
+	       (sizeof(FHeader) + Hashes.Num() * sizeof(uint64) + Offsets.Num() * sizeof(uint32) + Blob.Num()) /
+	       (1024.0 * 1024.0), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+	return true;
+}
+
+bool FAssetNameDictionary::ParseWniFile(const FString& FilePath,
+                                        TFunctionRef<void(uint64 Hash, const ANSICHAR* Name, int32 Length)> Visitor)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath)) return false;
+
+	FMemoryReader Ar(FileData, true);
+	uint32 Magic;
+	Ar << Magic;
+	if (Magic != 0x20494E57) // 'WNI '
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid file format: %s"), *FilePath);
+		return false;
+	}
+
+	// 版本号
+	Ar.Seek(Ar.Tell() + 2);
+
+	// 条目数
+	uint32 EntryCount;
+	Ar << EntryCount;
+
+	// 压缩大小
+	uint32 PackedSize, UnpackedSize;
+	Ar << PackedSize;
+	Ar << UnpackedSize;
+
+	// 校验剩余数据大小
+	const int64 RemainingSize = Ar.TotalSize() - Ar.Tell();
+	if (RemainingSize < PackedSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Corrupted file: %s"), *FilePath);
+		return false;
+	}
+
+	// 准备解压缓冲区
+	TArray<uint8> DecompressedData;
+	const int32 PaddedSize = (UnpackedSize + 3) & ~3;
+	DecompressedData.SetNumUninitialized(PaddedSize);
+
+	// LZ4解压，直接从文件缓冲区读取压缩数据
+	bool bDecompressSuccess = FCompression::UncompressMemory(
+		NAME_LZ4,
+		DecompressedData.GetData(),
+		UnpackedSize,
+		FileData.GetData() + Ar.Tell(),
+		PackedSize,
+		COMPRESS_NoFlags
+	);
+
+	if (!bDecompressSuccess)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Decompression failed: %s"), *FilePath);
+		return false;
+	}
+
+	const uint8* StreamPtr = DecompressedData.GetData();
+	const int64 StreamLength = UnpackedSize;
+	int64 CurrentPos = 0;
+
+	// 验证解压后数据足够存放EntryCount
+	if (StreamLength < static_cast<int64>(EntryCount * sizeof(uint64_t)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Corrupted decompressed data"));
+		return false;
+	}
+
+	// 解析条目
+	for (uint32 i = 0; i < EntryCount; ++i)
+	{
+		if (CurrentPos + static_cast<int64>(sizeof(uint64)) >= StreamLength)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Data overflow at entry %d in %s"), i, *FilePath);
+			break;
+		}
+
+		uint64 Key;
+		FMemory::Memcpy(&Key, StreamPtr + CurrentPos, sizeof(uint64));
+		Key &= 0x0FFFFFFFFFFFFFFF; // 应用掩码
+		CurrentPos += sizeof(uint64);
+
+		const ANSICHAR* StrStart = reinterpret_cast<const ANSICHAR*>(StreamPtr + CurrentPos);
+		const ANSICHAR* StrEnd = static_cast<const ANSICHAR*>(memchr(StrStart, 0, StreamLength - CurrentPos));
+		if (!StrEnd)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Unterminated string at entry %d"), i);
+			break;
+		}
+
+		const int32 StrLen = static_cast<int32>(StrEnd - StrStart);
+		Visitor(Key, StrStart, StrLen);
+		CurrentPos += StrLen + 1; // 跳过null终止符
+	}
+	return true;
+}
@@ -0,0 +1,91 @@
+﻿#include "Database/AssetNameIndex.h"
+
+FAssetNameIndex::FAssetNameIndex(int32 ExpectedCount)
+{
+	// Keep the load factor at or below one half so probe chains stay short.
+	const uint32 SlotCount = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(ExpectedCount * 2, 16));
+	SlotMask = SlotCount - 1;
+	Keys.Init(EmptyKey, SlotCount);
+	NameOffsets.SetNumZeroed(SlotCount);
+	NameLengths.SetNumZeroed(SlotCount);
+	Arena.Reserve(ExpectedCount * 32);
+}
+
+void FAssetNameIndex::Add(uint64 Hash, const FString& Value)
+{
+	Hash &= HashMask;
+	// ExpectedCount is only a hint; keep the load factor at one half however many names arrive.
+	if (static_cast<uint32>(Count + 1) * 2 > SlotMask + 1)
+	{
+		Grow();
+	}
+	uint32 Slot = GetHomeSlot(Hash);
+	while (Keys[Slot] != EmptyKey && Keys[Slot] != Hash)
+	{
+		Slot = (Slot + 1) & SlotMask;
+	}
+	if (Keys[Slot] == EmptyKey)
+	{
+		++Count;
+	}
+
+	const FTCHARToUTF8 Utf8Value(*Value);
+	Keys[Slot] = Hash;
+	NameOffsets[Slot] = Arena.Num();
+	NameLengths[Slot] = Utf8Value.Length();
+	Arena.Append(reinterpret_cast<const UTF8CHAR*>(Utf8Value.Get()), Utf8Value.Length());
+}
+
+void FAssetNameIndex::Grow()
+{
+	TArray<uint64> OldKeys = MoveTemp(Keys);
+	TArray<uint32> OldNameOffsets = MoveTemp(NameOffsets);
+	TArray<uint32> OldNameLengths = MoveTemp(NameLengths);
+
+	const uint32 SlotCount = (SlotMask + 1) * 2;
+	SlotMask = SlotCount - 1;
+	Keys.Init(EmptyKey, SlotCount);
+	NameOffsets.SetNumZeroed(SlotCount);
+	NameLengths.SetNumZeroed(SlotCount);
+
+	for (int32 OldSlot = 0; OldSlot < OldKeys.Num(); ++OldSlot)
+	{
+		if (OldKeys[OldSlot] == EmptyKey) continue;
+		uint32 Slot = GetHomeSlot(OldKeys[OldSlot]);
+		while (Keys[Slot] != EmptyKey)
+		{
+			Slot = (Slot + 1) & SlotMask;
+		}
+		Keys[Slot] = OldKeys[OldSlot];
+		NameOffsets[Slot] = OldNameOffsets[OldSlot];
+		NameLengths[Slot] = OldNameLengths[OldSlot];
+	}
+}
+
+int32 FAssetNameIndex::FindSlot(uint64 Hash) const
+{
+	Hash &= HashMask;
+	uint32 Slot = GetHomeSlot(Hash);
+	while (true)
+	{
+		const uint64 Key = Keys[Slot];
+		if (Key == Hash) return Slot;
+		if (Key == EmptyKey) return INDEX_NONE;
+		Slot = (Slot + 1) & SlotMask;
+	}
+}
+
+TOptional<FString> FAssetNameIndex::Find(uint64 Hash) const
+{
+	const int32 Slot = FindSlot(Hash);
+	if (Slot == INDEX_NONE) return TOptional<FString>();
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Arena.GetData() + NameOffsets[Slot]),
+	                             NameLengths[Slot]);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+SIZE_T FAssetNameIndex::GetAllocatedSize() const
+{
+	return Keys.GetAllocatedSize() + NameOffsets.GetAllocatedSize() + NameLengths.GetAllocatedSize() +
+		Arena.GetAllocatedSize();
+}
@@ -1,6 +1,8 @@
 ﻿#include "Database/CoDDatabaseService.h"
 
 #include "SeLogChannels.h"
+#include "Database/AssetNameDictionary.h"
+#include "Database/AssetNameIndex.h"
 #include "Database/CoDFileTracker.h"
 #include "Database/DatabaseAsyncTaskQueue.h"
 #include "Database/SqliteAssetNameRepository.h"
@@ -8,9 +10,23 @@
 #include "Database/SqliteFileMetaRepository.h"
 #include "Database/SqliteGameRepository.h"
 #include "Database/SqliteXSubInfoRepository.h"
+#include "Database/XSubInfoIndex.h"
 #include "Interface/IAsyncTaskQueue.h"
 #include "Interface/IFileTracker.h"
 #include "MapImporter/XSub.h"
+#include "Algo/Unique.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	FAutoConsoleCommand CmdBenchmarkIndices(
+		TEXT("IWToUE.Database.BenchmarkIndices"),
+		TEXT("Times lookups against the in-memory asset name and XSub indices and logs the throughput."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FCoDDatabaseService::Get().RunIndexBenchmarksAsync();
+		}));
+}
 
 FCoDDatabaseService& FCoDDatabaseService::Get()
 {
@@ -26,8 +42,9 @@ void FCoDDatabaseService::Initialize(const FString& PreferredDatabasePath)
 	bIsFileTrackingComplete = false;
 
 	Connection = MakeShared<FSQLiteConnection>();
-	if (const FString DBPath = PreferredDatabasePath.IsEmpty() ? GetDefaultDatabasePath() : PreferredDatabasePath;
-		!Connection->Open(DBPath))
+	const FString DBPath = PreferredDatabasePath.IsEmpty() ? GetDefaultDatabasePath() : PreferredDatabasePath;
+	NameDictionaryPath = FPaths::GetPath(DBPath) / TEXT("AssetNames.dict");
+	if (!Connection->Open(DBPath))
 	{
 		UE_LOG(LogITUDatabase, Fatal, TEXT("Database Service failed to initialize connection."));
 		Connection.Reset();
@@ -42,7 +59,8 @@ void FCoDDatabaseService::Initialize(const FString& PreferredDatabasePath)
 	AsyncTaskQueue = MakeShared<FDatabaseAsyncTaskQueue>();
 	AsyncTaskQueue->TaskStart();
 
-	FileTracker = MakeShared<FCoDFileTracker>(FileMetaRepo, GameRepo, AssetNameRepo, XSubInfoRepo);
+	FileTracker = MakeShared<FCoDFileTracker>(FileMetaRepo, GameRepo, AssetNameRepo, XSubInfoRepo,
+	                                          NameDictionaryPath);
 	if (FileTracker)
 	{
 		FileTracker->OnComplete.BindRaw(this, &FCoDDatabaseService::HandleFileTrackingComplete);
@@ -72,6 +90,19 @@ void FCoDDatabaseService::Shutdown()
 		AsyncTaskQueue.Reset();
 	}
 
+	AssetNameIndex = nullptr;
+	AssetNameIndices.Empty();
+	AssetNameDictionary = nullptr;
+	AssetNameDictionaries.Empty();
+	MappedDictionaryPath.Empty();
+	XSubInfoIndex = nullptr;
+	XSubInfoIndices.Empty();
+	{
+		FWriteScopeLock WriteLock(NameOverridesLock);
+		NameOverrides.Empty();
+		bHasNameOverrides = false;
+	}
+
 	AssetNameRepo.Reset();
 	XSubInfoRepo.Reset();
 	FileMetaRepo.Reset();
@@ -139,6 +170,11 @@ void FCoDDatabaseService::SetCurrentGameContext(uint64 GameHash, const FString&
 		}
 	}
 
+	// Stop serving the previous game's XSub rows; lookups fall back to SQLite until the rebuild publishes a new
+	// index. The retired index stays alive in XSubInfoIndices for readers that already loaded it. Asset names are
+	// not per game, so the name index and the WNI dictionary keep serving.
+	XSubInfoIndex.store(nullptr, std::memory_order_release);
+
 	FileTracker->Initialize(CurrentGameHash, CurrentGamePath);
 	FileTracker->StartTrackingAsync();
 }
@@ -163,7 +199,86 @@ TOptional<FString> FCoDDatabaseService::GetAssetNameSync(uint64 Hash)
 		       ));
 		return TOptional<FString>();
 	}
-	return AssetNameRepo->QueryValue(Hash);
+	TOptional<FString> IndexedName;
+	if (TryGetIndexedAssetName(Hash, IndexedName))
+	{
+		return IndexedName;
+	}
+	return ResolveStoredAssetName(AssetNameRepo->QueryValue(Hash), AssetNameDictionary.load(std::memory_order_acquire),
+	                              Hash);
+}
+
+int32 FCoDDatabaseService::ResolveNamesBatch(TArrayView<const uint64> Hashes, TArray<FString>& OutNames,
+                                            const FString& NamePrefix)
+{
+	TArray<uint64> UniqueHashes;
+	UniqueHashes.Reserve(Hashes.Num());
+	for (const uint64 Hash : Hashes)
+	{
+		UniqueHashes.Add(Hash & FAssetNameIndex::HashMask);
+	}
+	UniqueHashes.Sort();
+	UniqueHashes.SetNum(Algo::Unique(UniqueHashes));
+
+	TMap<uint64, FString> KnownNames;
+	KnownNames.Reserve(UniqueHashes.Num());
+	if (bIsInitialized && AssetNameRepo && bIsFileTrackingComplete.load())
+	{
+		if (AssetNameIndex.load(std::memory_order_acquire))
+		{
+			TOptional<FString> IndexedName;
+			for (const uint64 Hash : UniqueHashes)
+			{
+				if (TryGetIndexedAssetName(Hash, IndexedName) && IndexedName.IsSet())
+				{
+					KnownNames.Add(Hash, MoveTemp(IndexedName.GetValue()));
+				}
+			}
+		}
+		else
+		{
+			// No index yet: one IN (...) query per few hundred hashes instead of one query per hash.
+			AssetNameRepo->QueryValues(UniqueHashes, KnownNames);
+			const FAssetNameDictionary* Dictionary = AssetNameDictionary.load(std::memory_order_acquire);
+			for (const uint64 Hash : UniqueHashes)
+			{
+				TOptional<FString> StoredName;
+				if (FString* Stored = KnownNames.Find(Hash))
+				{
+					StoredName = MoveTemp(*Stored);
+				}
+				if (TOptional<FString> Name = ResolveStoredAssetName(MoveTemp(StoredName), Dictionary, Hash))
+				{
+					KnownNames.Add(Hash, MoveTemp(Name.GetValue()));
+				}
+				else
+				{
+					KnownNames.Remove(Hash);
+				}
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogITUDatabase, Warning, TEXT("ResolveNamesBatch called before file tracking completed."));
+	}
+
+	int32 ResolvedCount = 0;
+	OutNames.Reset(Hashes.Num());
+	for (const uint64 Hash : Hashes)
+	{
+		const uint64 MaskedHash = Hash & FAssetNameIndex::HashMask;
+		if (const FString* Name = KnownNames.Find(MaskedHash))
+		{
+			OutNames.Add(*Name);
+			++ResolvedCount;
+		}
+		else
+		{
+			OutNames.Add(FString::Printf(TEXT("%s_%llx"), *NamePrefix, MaskedHash));
+		}
+	}
+	return ResolvedCount;
 }
 
 void FCoDDatabaseService::GetAssetNameAsync(uint64 Hash, TFunction<void(TOptional<FString>)> Callback)
@@ -175,9 +290,20 @@ void FCoDDatabaseService::GetAssetNameAsync(uint64 Hash, TFunction<void(TOptiona
 		return;
 	}
 
-	TFunction<void()> DbTask = [Repo = AssetNameRepo, Hash, Callback]()
+	TOptional<FString> IndexedName;
+	if (TryGetIndexedAssetName(Hash, IndexedName))
 	{
-		TOptional<FString> Result = Repo->QueryValue(Hash);
+		AsyncTask(ENamedThreads::GameThread, [Callback, Result = MoveTemp(IndexedName)]()
+		{
+			if (Callback) Callback(Result);
+		});
+		return;
+	}
+
+	TFunction<void()> DbTask = [this, Repo = AssetNameRepo, Hash, Callback]()
+	{
+		TOptional<FString> Result = ResolveStoredAssetName(Repo->QueryValue(Hash),
+		                                                   AssetNameDictionary.load(std::memory_order_acquire), Hash);
 		AsyncTask(ENamedThreads::GameThread, [Callback, Result]()
 		{
 			if (Callback) Callback(Result);
@@ -199,6 +325,7 @@ void FCoDDatabaseService::UpdateAssetNameAsync(uint64 Hash, const FString& Value
 			});
 		return;
 	}
+	SetAssetNameOverride(Hash, Value);
 	TFunction<void()> DbTask = [Repo = AssetNameRepo, Hash, Value, CompletionCallback]()
 	{
 		bool bSuccess = Repo->InsertOrUpdate(Hash, Value);
@@ -223,6 +350,10 @@ void FCoDDatabaseService::UpdateAssetNameBatchAsync(const TMap<uint64, FString>&
 			});
 		return;
 	}
+	for (const TPair<uint64, FString>& Item : Items)
+	{
+		SetAssetNameOverride(Item.Key, Item.Value);
+	}
 	TMap<uint64, FString> ItemsCopy = Items;
 	TFunction<void()> DbTask = [Repo = AssetNameRepo, Items = MoveTemp(ItemsCopy), CompletionCallback]() mutable
 	{
@@ -247,9 +378,14 @@ void FCoDDatabaseService::DeleteAssetNameAsync(uint64 Hash, TFunction<void(bool)
 			});
 		return;
 	}
-	TFunction<void()> DbTask = [Repo = AssetNameRepo, Hash, CompletionCallback]()
+	SetAssetNameOverride(Hash, TOptional<FString>());
+	TFunction<void()> DbTask = [this, Repo = AssetNameRepo, Hash, CompletionCallback]()
 	{
-		bool bSuccess = Repo->DeleteByHash(Hash);
+		// Deleting the row would bring the WNI name back, so it is hidden behind an empty value instead.
+		const FAssetNameDictionary* Dictionary = AssetNameDictionary.load(std::memory_order_acquire);
+		bool bSuccess = Dictionary && Dictionary->Contains(Hash)
+			                ? Repo->InsertOrUpdate(Hash & FAssetNameIndex::HashMask, FString())
+			                : Repo->DeleteByHash(Hash);
 		if (CompletionCallback)
 		{
 			AsyncTask(ENamedThreads::GameThread, [CompletionCallback, bSuccess]() { CompletionCallback(bSuccess); });
@@ -270,6 +406,10 @@ TOptional<FXSubPackageCacheObject> FCoDDatabaseService::GetXSubInfoSync(uint64 D
 		       ));
 		return TOptional<FXSubPackageCacheObject>();
 	}
+	if (const FXSubInfoIndex* Index = XSubInfoIndex.load(std::memory_order_acquire))
+	{
+		return Index->Find(DecryptionKey);
+	}
 	return XSubInfoRepo->QueryValue(DecryptionKey);
 }
 
@@ -286,6 +426,15 @@ void FCoDDatabaseService::GetXSubInfoAsync(uint64 DecryptionKey,
 		return;
 	}
 
+	if (const FXSubInfoIndex* Index = XSubInfoIndex.load(std::memory_order_acquire))
+	{
+		AsyncTask(ENamedThreads::GameThread, [Callback, Result = Index->Find(DecryptionKey)]()
+		{
+			if (Callback) Callback(Result);
+		});
+		return;
+	}
+
 	TFunction<void()> DbTask = [Repo = XSubInfoRepo, DecryptionKey, Callback]()
 	{
 		TOptional<FXSubPackageCacheObject> Result = Repo->QueryValue(DecryptionKey);
@@ -319,6 +468,9 @@ FString FCoDDatabaseService::GetDefaultDatabasePath() const
 
 void FCoDDatabaseService::HandleFileTrackingComplete()
 {
+	// Published before lookups are permitted, so WNI names resolve even before the first index rebuild.
+	MapLatestAssetNameDictionary();
+
 	bool bCompExpected = false;
 	if (bIsFileTrackingComplete.compare_exchange_strong(bCompExpected, true))
 	{
@@ -330,6 +482,13 @@ void FCoDDatabaseService::HandleFileTrackingComplete()
 			OnFileTrackingComplete.Broadcast();
 		});
 
+		// Queued ahead of the deferred lookups so they can be answered from the new index.
+		AsyncTaskQueue->EnqueueTask([this]()
+		{
+			RebuildAssetNameIndex();
+			RebuildXSubInfoIndex();
+		});
+
 		TFunction<void()> DeferredTask;
 		while (true)
 		{
@@ -357,6 +516,219 @@ void FCoDDatabaseService::HandleFileTrackingComplete()
 	}
 }
 
+void FCoDDatabaseService::MapLatestAssetNameDictionary()
+{
+	const FString DictionaryPath = FAssetNameDictionary::FindLatestFile(NameDictionaryPath);
+	if (DictionaryPath.IsEmpty() || DictionaryPath == MappedDictionaryPath) return;
+
+	if (TUniquePtr<FAssetNameDictionary> Dictionary = FAssetNameDictionary::Open(DictionaryPath))
+	{
+		UE_LOG(LogITUDatabase, Log, TEXT("Mapped asset name dictionary %s with %lld names."), *DictionaryPath,
+		       Dictionary->Num());
+		AssetNameDictionary.store(Dictionary.Get(), std::memory_order_release);
+		AssetNameDictionaries.Add(MoveTemp(Dictionary));
+		MappedDictionaryPath = DictionaryPath;
+	}
+}
+
+void FCoDDatabaseService::RebuildAssetNameIndex()
+{
+	if (!AssetNameRepo) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	TUniquePtr<FAssetNameIndex> NewIndex = MakeUnique<FAssetNameIndex>(AssetNameRepo->QueryCount());
+	AssetNameRepo->QueryAll([&NewIndex](uint64 Hash, const FString& Value)
+	{
+		NewIndex->Add(Hash, Value);
+	});
+	const double BuildMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	UE_LOG(LogITUDatabase, Log, TEXT("Asset name index built: %d names, %.1f MB, %.2f ms."),
+	       NewIndex->Num(), NewIndex->GetAllocatedSize() / (1024.0 * 1024.0), BuildMs);
+
+	AssetNameIndex.store(NewIndex.Get(), std::memory_order_release);
+	FoldAssetNameOverrides(*NewIndex);
+	AssetNameIndices.Add(MoveTemp(NewIndex));
+}
+
+void FCoDDatabaseService::FoldAssetNameOverrides(const FAssetNameIndex& Index)
+{
+	if (!bHasNameOverrides.load(std::memory_order_acquire)) return;
+
+	// Overrides win over the index, so dropping one is safe once the index answers the same. The index was read
+	// after every queued write ahead of this task, so most overrides go here and the map stays small.
+	const FAssetNameDictionary* Dictionary = AssetNameDictionary.load(std::memory_order_acquire);
+	FWriteScopeLock WriteLock(NameOverridesLock);
+	const int32 OverrideCount = NameOverrides.Num();
+	for (auto It = NameOverrides.CreateIterator(); It; ++It)
+	{
+		if (FindIndexedAssetName(Index, Dictionary, It.Key()) == It.Value())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	NameOverrides.Compact();
+	bHasNameOverrides = NameOverrides.Num() > 0;
+	UE_LOG(LogITUDatabase, Verbose, TEXT("Folded %d of %d asset name overrides into the index."),
+	       OverrideCount - NameOverrides.Num(), OverrideCount);
+}
+
+void FCoDDatabaseService::RunIndexBenchmarksAsync()
+{
+	EnqueueActualDbTask([this]()
+	{
+		BenchmarkAssetNameIndex();
+		BenchmarkXSubInfoIndex();
+	});
+}
+
+void FCoDDatabaseService::BenchmarkAssetNameIndex()
+{
+	const FAssetNameIndex* Index = AssetNameIndex.load(std::memory_order_acquire);
+	if (!Index || !AssetNameRepo)
+	{
+		UE_LOG(LogITUDatabase, Warning, TEXT("Asset name index benchmark skipped: no index has been published."));
+		return;
+	}
+
+	constexpr int32 SampleCount = 100000;
+	TArray<uint64> SampleHashes;
+	SampleHashes.Reserve(FMath::Min(SampleCount, Index->Num()));
+	AssetNameRepo->QueryAll([&SampleHashes](uint64 Hash, const FString&)
+	{
+		if (SampleHashes.Num() < SampleCount) SampleHashes.Add(Hash);
+	});
+
+	const uint64 LookupStartCycles = FPlatformTime::Cycles64();
+	int32 Found = 0;
+	for (const uint64 Hash : SampleHashes)
+	{
+		Found += Index->Find(Hash).IsSet() ? 1 : 0;
+	}
+	const double LookupSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LookupStartCycles);
+
+	UE_LOG(LogITUDatabase, Log, TEXT("Asset name index: %d/%d known keys found at %.0f lookups/s."),
+	       Found, SampleHashes.Num(), LookupSeconds > 0.0 ? SampleHashes.Num() / LookupSeconds : 0.0);
+}
+
+void FCoDDatabaseService::RebuildXSubInfoIndex()
+{
+	if (!XSubInfoRepo) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	TUniquePtr<FXSubInfoIndex> NewIndex = MakeUnique<FXSubInfoIndex>(XSubInfoRepo->QueryCount());
+	XSubInfoRepo->QueryFilePaths([&NewIndex](int64 FileId, const FString& AbsolutePath)
+	{
+		NewIndex->AddFile(FileId, AbsolutePath);
+	});
+	XSubInfoRepo->QueryAll([&NewIndex](uint64 DecryptionKey, const FXSubPackageCacheObject& Value)
+	{
+		NewIndex->Add(DecryptionKey, Value.FileId, Value.Offset, Value.CompressedSize, Value.UncompressedSize);
+	});
+	NewIndex->Finalize();
+	const double BuildMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	UE_LOG(LogITUDatabase, Log, TEXT("XSub info index built: %d entries in %d files, %.1f MB, %.2f ms."),
+	       NewIndex->Num(), NewIndex->NumFiles(), NewIndex->GetAllocatedSize() / (1024.0 * 1024.0), BuildMs);
+
+	XSubInfoIndex.store(NewIndex.Get(), std::memory_order_release);
+	XSubInfoIndices.Add(MoveTemp(NewIndex));
+}
+
+void FCoDDatabaseService::BenchmarkXSubInfoIndex()
+{
+	const FXSubInfoIndex* Index = XSubInfoIndex.load(std::memory_order_acquire);
+	if (!Index || !XSubInfoRepo)
+	{
+		UE_LOG(LogITUDatabase, Warning, TEXT("XSub info index benchmark skipped: no index has been published."));
+		return;
+	}
+
+	TArray<uint64> KnownKeys;
+	KnownKeys.Reserve(Index->Num());
+	XSubInfoRepo->QueryAll([&KnownKeys](uint64 DecryptionKey, const FXSubPackageCacheObject&)
+	{
+		KnownKeys.Add(DecryptionKey);
+	});
+
+	// A million keys through the index, half of them known, and a small sample through SQLite.
+	constexpr int32 IndexSampleCount = 1000000;
+	constexpr int32 SqlSampleCount = 1000;
+	FRandomStream Random(0x5855);
+	TArray<uint64> SampleKeys;
+	SampleKeys.Reserve(IndexSampleCount);
+	for (int32 i = 0; i < IndexSampleCount; ++i)
+	{
+		const bool bKnown = KnownKeys.Num() > 0 && (i & 1) == 0;
+		SampleKeys.Add(bKnown
+			               ? KnownKeys[Random.RandHelper(KnownKeys.Num())]
+			               : (static_cast<uint64>(Random.GetUnsignedInt()) << 32) | Random.GetUnsignedInt());
+	}
+
+	uint64 LookupStartCycles = FPlatformTime::Cycles64();
+	int32 Found = 0;
+	for (const uint64 Key : SampleKeys)
+	{
+		Found += Index->Contains(Key) ? 1 : 0;
+	}
+	const double IndexSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LookupStartCycles);
+
+	LookupStartCycles = FPlatformTime::Cycles64();
+	const int32 SqlLookups = FMath::Min(SqlSampleCount, SampleKeys.Num());
+	for (int32 i = 0; i < SqlLookups; ++i)
+	{
+		XSubInfoRepo->QueryValue(SampleKeys[i]);
+	}
+	const double SqlSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LookupStartCycles);
+
+	UE_LOG(LogITUDatabase, Log,
+	       TEXT("XSub info index: %.0f lookups/s (%d/%d hits). SQLite: %.0f lookups/s."),
+	       IndexSeconds > 0.0 ? SampleKeys.Num() / IndexSeconds : 0.0, Found, SampleKeys.Num(),
+	       SqlSeconds > 0.0 ? SqlLookups / SqlSeconds : 0.0);
+}
+
+bool FCoDDatabaseService::TryGetIndexedAssetName(uint64 Hash, TOptional<FString>& OutName) const
+{
+	const FAssetNameIndex* Index = AssetNameIndex.load(std::memory_order_acquire);
+	if (!Index) return false;
+
+	Hash &= FAssetNameIndex::HashMask;
+	if (bHasNameOverrides.load(std::memory_order_acquire))
+	{
+		FReadScopeLock ReadLock(NameOverridesLock);
+		if (const TOptional<FString>* Override = NameOverrides.Find(Hash))
+		{
+			OutName = *Override;
+			return true;
+		}
+	}
+	OutName = FindIndexedAssetName(*Index, AssetNameDictionary.load(std::memory_order_acquire), Hash);
+	return true;
+}
+
+TOptional<FString> FCoDDatabaseService::FindIndexedAssetName(const FAssetNameIndex& Index,
+                                                             const FAssetNameDictionary* Dictionary, uint64 Hash)
+{
+	return ResolveStoredAssetName(Index.Find(Hash), Dictionary, Hash);
+}
+
+TOptional<FString> FCoDDatabaseService::ResolveStoredAssetName(TOptional<FString> StoredName,
+                                                               const FAssetNameDictionary* Dictionary, uint64 Hash)
+{
+	if (StoredName.IsSet())
+	{
+		return StoredName->IsEmpty() ? TOptional<FString>() : MoveTemp(StoredName);
+	}
+	return Dictionary ? Dictionary->Find(Hash) : TOptional<FString>();
+}
+
+void FCoDDatabaseService::SetAssetNameOverride(uint64 Hash, TOptional<FString> Value)
+{
+	FWriteScopeLock WriteLock(NameOverridesLock);
+	NameOverrides.Add(Hash & FAssetNameIndex::HashMask, MoveTemp(Value));
+	bHasNameOverrides = true;
+}
+
 void FCoDDatabaseService::EnqueueActualDbTask(TFunction<void()> Task)
 {
 	if (!bIsInitialized || !AsyncTaskQueue)
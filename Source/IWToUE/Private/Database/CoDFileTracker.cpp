@@ -1,18 +1,23 @@
 ﻿#include "Database/CoDFileTracker.h"
 
 #include "SeLogChannels.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Queue.h"
+#include "Database/AssetNameDictionary.h"
 #include "Interface/DatabaseRepository.h"
 #include "Interfaces/IPluginManager.h"
 #include "MapImporter/XSub.h"
-#include "Serialization/LargeMemoryReader.h"
-#include "Utils/BinaryReader.h"
+#include "MapImporter/XSubParser.h"
 
 
 FCoDFileTracker::FCoDFileTracker(const TSharedPtr<IFileMetaRepository>& InFileMetaRepo,
                                  const TSharedPtr<IGameRepository>& InGameRepo,
                                  const TSharedPtr<IAssetNameRepository>& InAssetNameRepo,
-                                 const TSharedPtr<IXSubInfoRepository>& InXSubInfoRepo)
-	: FileMetaRepo(InFileMetaRepo), GameRepo(InGameRepo), AssetNameRepo(InAssetNameRepo), XSubInfoRepo(InXSubInfoRepo)
+                                 const TSharedPtr<IXSubInfoRepository>& InXSubInfoRepo,
+                                 const FString& InNameDictionaryPath)
+	: FileMetaRepo(InFileMetaRepo), GameRepo(InGameRepo), AssetNameRepo(InAssetNameRepo), XSubInfoRepo(InXSubInfoRepo),
+	  NameDictionaryPath(InNameDictionaryPath)
 {
 }
 
@@ -67,69 +72,297 @@ void FCoDFileTracker::Stop()
 	bShouldRun = false;
 }
 
+struct FCoDFileTracker::FTrackedFile
+{
+	FString FilePath;
+	FString RelativePath;
+	uint64 GameHash = 0;
+	int64 LastModifiedTime = 0;
+	uint64 ContentHash = 0;
+	TOptional<IFileMetaRepository::FExistingFileInfo> ExistingInfo;
+	int64 FileId = -1;
+	// New, or its timestamp or fingerprint differs from the stored row.
+	bool bNeedsUpdate = false;
+};
+
 void FCoDFileTracker::ProcessFiles()
 {
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	// --- WNI Processing ---
+	// WNI names go into a memory-mapped dictionary rather than SQLite; it is rebuilt from all WNI files
+	// whenever any of them changed or the dictionary is missing.
 	TArray<FString> WniFiles = FindWniFilesToTrack();
-	TMap<uint64, FString> CombinedAssetNameMap;
-	int ProcessedWni = 0;
-	for (const FString& FilePath : WniFiles)
+	TArray<FTrackedFile> TrackedWniFiles = GatherTrackedFiles(WniFiles, 1, PluginBasePath);
+	RefreshFileMetas(TrackedWniFiles);
+	bool bRebuildDictionary = FAssetNameDictionary::FindLatestFile(NameDictionaryPath).IsEmpty();
+	for (const FTrackedFile& File : TrackedWniFiles)
+	{
+		bRebuildDictionary |= File.bNeedsUpdate;
+	}
+	bool bCommitWniMetas = bShouldRun;
+	if (bRebuildDictionary && bShouldRun && WniFiles.Num() > 0)
 	{
-		if (!bShouldRun) break;
+		UE_LOG(LogTemp, Log, TEXT("Rebuilding asset name dictionary from %d WNI files..."), WniFiles.Num());
+		bCommitWniMetas = FAssetNameDictionary::Build(WniFiles, NameDictionaryPath);
+		UE_LOG(LogTemp, Log, TEXT("Asset name dictionary rebuild %s."), bCommitWniMetas ? TEXT("succeeded") : TEXT("FAILED"));
+	}
+	// A failed build leaves the rows stale so the next run rebuilds again.
+	for (FTrackedFile& File : TrackedWniFiles)
+	{
+		if (!bCommitWniMetas) break;
+		if (File.bNeedsUpdate) CommitFileMeta(File);
+	}
+	// Older versions copied WNI names into AssetNameCache, where they would shadow the dictionary. They are removed
+	// once; rows written after that are user edits and take priority over the dictionary.
+	const FString DictionaryPath = FAssetNameDictionary::FindLatestFile(NameDictionaryPath);
+	if (bShouldRun && AssetNameRepo && !DictionaryPath.IsEmpty())
+	{
+		if (const TUniquePtr<FAssetNameDictionary> Dictionary = FAssetNameDictionary::Open(DictionaryPath))
+		{
+			AssetNameRepo->DeleteLegacyWniNames([&Dictionary](uint64 Hash) { return Dictionary->Contains(Hash); });
+		}
+	}
+	const uint64 WniDoneCycles = FPlatformTime::Cycles64();
 
-		FString RelativePath = GetRelativePath(FilePath, PluginBasePath);
-		uint64 ContentHash = ComputeFileContentHash(FilePath);
-		int64 LastModifiedTime = GetFileLastModifiedTime(FilePath);
-		int64 FileId = -1;
-		bool bNeedsUpdate = CheckIfFileNeedsUpdate(1, RelativePath, ContentHash, LastModifiedTime, FileId);
+	// --- XSub Processing ---
+	int32 XSubFileCount = 0;
+	int32 ProcessedXSub = 0;
+	if (CurrentGameHash != 0 && !CurrentGamePath.IsEmpty() && bShouldRun)
+	{
+		TArray<FTrackedFile> TrackedXSubFiles = GatherTrackedFiles(FindXSubFilesToTrack(), CurrentGameHash,
+		                                                           CurrentGamePath);
+		XSubFileCount = TrackedXSubFiles.Num();
+		RefreshFileMetas(TrackedXSubFiles);
 
-		if (bNeedsUpdate && FileId != -1)
+		TArray<FTrackedFile*> ChangedFiles;
+		for (FTrackedFile& File : TrackedXSubFiles)
 		{
-			TMap<uint64, FString> Items;
-			ParseWniFile(FilePath, Items);
-			CombinedAssetNameMap.Append(Items);
-			ProcessedWni++;
+			if (!bShouldRun) break;
+			if (!File.bNeedsUpdate) continue;
+			if (File.FileId == -1 && !ReserveFileId(File)) continue;
+			ChangedFiles.Add(&File);
 		}
+		ProcessedXSub = ParseAndStoreXSubFiles(ChangedFiles);
 	}
-	if (CombinedAssetNameMap.Num() > 0)
+
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	UE_LOG(LogITUDatabase, Log,
+	       TEXT("File tracking ready in %.2f ms: %d WNI files in %.2f ms, %d of %d XSub files re-indexed in %.2f ms."),
+	       FPlatformTime::ToMilliseconds64(EndCycles - StartCycles), WniFiles.Num(),
+	       FPlatformTime::ToMilliseconds64(WniDoneCycles - StartCycles), ProcessedXSub, XSubFileCount,
+	       FPlatformTime::ToMilliseconds64(EndCycles - WniDoneCycles));
+}
+
+TArray<FCoDFileTracker::FTrackedFile> FCoDFileTracker::GatherTrackedFiles(
+	const TArray<FString>& FilePaths, uint64 GameHash, const FString& BaseDir) const
+{
+	TArray<FTrackedFile> Files;
+	Files.Reserve(FilePaths.Num());
+	for (const FString& FilePath : FilePaths)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Updating AssetName cache from %d WNI files..."), ProcessedWni);
-		bool bWniBatchOk = AssetNameRepo->BatchInsertOrUpdate(CombinedAssetNameMap);
-		UE_LOG(LogTemp, Log, TEXT("WNI AssetName batch update %s."), bWniBatchOk ? TEXT("succeeded") : TEXT("FAILED"));
+		FTrackedFile& File = Files.AddDefaulted_GetRef();
+		File.FilePath = FilePath;
+		File.RelativePath = GetRelativePath(FilePath, BaseDir);
+		File.GameHash = GameHash;
 	}
-	// --- XSub Processing ---
-	if (CurrentGameHash != 0 && !CurrentGamePath.IsEmpty())
+	return Files;
+}
+
+void FCoDFileTracker::RefreshFileMetas(TArray<FTrackedFile>& Files)
+{
+	for (FTrackedFile& File : Files)
+	{
+		if (!bShouldRun) return;
+		File.ExistingInfo = FileMetaRepo->QueryFileInfo(File.GameHash, File.RelativePath);
+	}
+
+	RunOnWorkers(Files.Num(), [this, &Files](int32 Index)
 	{
-		TArray<FString> XSubFiles = FindXSubFilesToTrack();
-		TMap<uint64, FXSubPackageCacheObject> CombinedXSubMap;
-		int ProcessedXSub = 0;
-		for (const FString& FilePath : XSubFiles)
+		FTrackedFile& File = Files[Index];
+		File.LastModifiedTime = GetFileLastModifiedTime(File.FilePath);
+		if (File.ExistingInfo.IsSet() && File.ExistingInfo->LastModifiedTime == File.LastModifiedTime)
 		{
-			if (!bShouldRun) break;
+			// Unchanged timestamp: trust the stored hash instead of reading the file again.
+			File.ContentHash = File.ExistingInfo->ContentHash;
+			return;
+		}
+		File.ContentHash = ComputeFileContentHash(File.FilePath);
+	});
+
+	for (FTrackedFile& File : Files)
+	{
+		if (!File.ExistingInfo.IsSet())
+		{
+			File.bNeedsUpdate = true;
+			continue;
+		}
+		File.FileId = File.ExistingInfo->FileId;
+		// The fingerprint only samples the file, so a same-size patch outside the samples leaves it unchanged.
+		// Both it and the timestamp have to match for the file to count as unchanged.
+		File.bNeedsUpdate = File.ExistingInfo->ContentHash != File.ContentHash ||
+			File.ExistingInfo->LastModifiedTime != File.LastModifiedTime;
+	}
+}
 
-			FString RelativePath = GetRelativePath(FilePath, CurrentGamePath);
-			uint64 ContentHash = ComputeFileContentHash(FilePath);
-			int64 LastModifiedTime = GetFileLastModifiedTime(FilePath);
-			int64 FileId = -1;
+bool FCoDFileTracker::CommitFileMeta(FTrackedFile& File)
+{
+	if (!FileMetaRepo->InsertOrUpdateFile(File.GameHash, File.RelativePath, File.ContentHash, File.LastModifiedTime,
+	                                      File.FileId))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write FileMeta for %s"), *File.RelativePath);
+		return false;
+	}
+	if (File.FileId == -1)
+	{
+		const TOptional<IFileMetaRepository::FExistingFileInfo> NewInfo =
+			FileMetaRepo->QueryFileInfo(File.GameHash, File.RelativePath);
+		if (!NewInfo.IsSet())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to insert FileMeta for %s"), *File.RelativePath);
+			return false;
+		}
+		File.FileId = NewInfo->FileId;
+	}
+	File.ExistingInfo = IFileMetaRepository::FExistingFileInfo{File.ContentHash, File.LastModifiedTime, File.FileId};
+	File.bNeedsUpdate = false;
+	return true;
+}
 
-			bool bNeedsUpdate = CheckIfFileNeedsUpdate(CurrentGameHash, RelativePath, ContentHash, LastModifiedTime,
-			                                           FileId);
+bool FCoDFileTracker::ReserveFileId(FTrackedFile& File)
+{
+	if (FileMetaRepo->InsertOrUpdateFile(File.GameHash, File.RelativePath, 0, 0))
+	{
+		if (const TOptional<IFileMetaRepository::FExistingFileInfo> NewInfo =
+			FileMetaRepo->QueryFileInfo(File.GameHash, File.RelativePath))
+		{
+			File.FileId = NewInfo->FileId;
+			return true;
+		}
+	}
+	UE_LOG(LogTemp, Error, TEXT("Failed to insert FileMeta for %s"), *File.RelativePath);
+	return false;
+}
 
-			if (bNeedsUpdate && FileId != -1)
+int32 FCoDFileTracker::ParseAndStoreXSubFiles(const TArray<FTrackedFile*>& Files)
+{
+	if (Files.Num() == 0) return 0;
+
+	// Keyed by position in Files, so results can be diffed in file order whatever order the workers finish in.
+	// Unset items mark a file that failed to parse.
+	using FParsedItems = TOptional<TMap<uint64, FXSubPackageCacheObject>>;
+	using FParsedFile = TPair<int32, FParsedItems>;
+	TQueue<FParsedFile, EQueueMode::Mpsc> ParsedFiles;
+	FEvent* ParsedEvent = FPlatformProcess::GetSynchEventFromPool();
+	std::atomic<bool> bParsingDone{false};
+	std::atomic<uint64> ParseCycles{0};
+
+	auto ParseFile = [&Files, &ParsedFiles, ParsedEvent, &ParseCycles, this](int32 Index)
+	{
+		const uint64 ParseStartCycles = FPlatformTime::Cycles64();
+		TMap<uint64, FXSubPackageCacheObject> Items;
+		const bool bParsed = ParseXSubFile(Files[Index]->FilePath, Items, Files[Index]->FileId);
+		ParseCycles += FPlatformTime::Cycles64() - ParseStartCycles;
+		ParsedFiles.Enqueue(FParsedFile(Index, bParsed ? FParsedItems(MoveTemp(Items)) : FParsedItems()));
+		ParsedEvent->Trigger();
+	};
+	TFuture<void> ParseTask = Async(EAsyncExecution::TaskGraph, [this, &Files, &ParseFile, ParsedEvent, &bParsingDone]()
+	{
+		RunOnWorkers(Files.Num(), ParseFile);
+		bParsingDone = true;
+		ParsedEvent->Trigger();
+	});
+
+	// This thread is the only SQLite user. While the workers keep parsing it diffs each parsed file against the
+	// rows stored for it, so only added, changed and removed keys are written, all in one transaction at the end.
+	// Files are diffed strictly in order, so a key found in several files resolves the same way on every run.
+	TMap<uint64, FXSubPackageCacheObject> Upserts;
+	TArray<uint64> Deletes;
+	TMap<int32, FParsedItems> EarlyFiles;
+	TBitArray<> FailedFiles(false, Files.Num());
+	int32 NextFile = 0;
+	int32 DiffedFiles = 0;
+	int64 UnchangedRows = 0;
+	while (true)
+	{
+		const bool bWasDone = bParsingDone.load();
+		FParsedFile Parsed;
+		while (ParsedFiles.Dequeue(Parsed))
+		{
+			EarlyFiles.Add(Parsed.Key, MoveTemp(Parsed.Value));
+		}
+		FParsedItems ParsedItems;
+		for (; EarlyFiles.RemoveAndCopyValue(NextFile, ParsedItems); ++NextFile)
+		{
+			if (!ParsedItems.IsSet())
+			{
+				// Diffing an empty parse would delete every row stored for the file.
+				UE_LOG(LogTemp, Warning, TEXT("Keeping stored XSub rows for %s: the file failed to parse."),
+				       *Files[NextFile]->RelativePath);
+				FailedFiles[NextFile] = true;
+				continue;
+			}
+			TMap<uint64, FXSubPackageCacheObject> StoredItems;
+			XSubInfoRepo->QueryByFile(Files[NextFile]->FileId, StoredItems);
+			for (TPair<uint64, FXSubPackageCacheObject>& Item : ParsedItems.GetValue())
+			{
+				const FXSubPackageCacheObject* Stored = StoredItems.Find(Item.Key);
+				if (Stored && Stored->Offset == Item.Value.Offset &&
+					Stored->CompressedSize == Item.Value.CompressedSize &&
+					Stored->UncompressedSize == Item.Value.UncompressedSize)
+				{
+					// A later file holding the key unchanged wins over an earlier file's upsert.
+					Upserts.Remove(Item.Key);
+					++UnchangedRows;
+				}
+				else
+				{
+					Upserts.Add(Item.Key, MoveTemp(Item.Value));
+				}
+				StoredItems.Remove(Item.Key);
+			}
+			for (const TPair<uint64, FXSubPackageCacheObject>& Removed : StoredItems)
 			{
-				TMap<uint64, FXSubPackageCacheObject> Items;
-				ParseXSubFile(FilePath, Items, FileId);
-				CombinedXSubMap.Append(Items);
-				ProcessedXSub++;
+				Deletes.Add(Removed.Key);
 			}
+			++DiffedFiles;
 		}
-		if (CombinedXSubMap.Num() > 0)
+		if (bWasDone) break;
+		ParsedEvent->Wait(100);
+	}
+	ParseTask.Wait();
+	FPlatformProcess::ReturnSynchEventToPool(ParsedEvent);
+
+	// A stopped pass writes nothing; its files keep their old FileMeta rows and are parsed again next time.
+	// Failed files keep their old FileMeta row as well, so they are retried next time.
+	const bool bApplyOk = bShouldRun && NextFile == Files.Num() && XSubInfoRepo->ApplyChanges(Upserts, Deletes);
+	if (bApplyOk)
+	{
+		for (int32 Index = 0; Index < Files.Num(); ++Index)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Updating XSub cache from %d XSub files..."), ProcessedXSub);
-			bool bXsubBatchOk = XSubInfoRepo->BatchInsertOrUpdate(CombinedXSubMap);
-			UE_LOG(LogTemp, Log, TEXT("XSub batch update %s."), bXsubBatchOk ? TEXT("succeeded") : TEXT("FAILED"));
+			if (!FailedFiles[Index]) CommitFileMeta(*Files[Index]);
 		}
 	}
+	const double ParseSeconds = FPlatformTime::ToSeconds64(ParseCycles.load());
+	UE_LOG(LogTemp, Log,
+	       TEXT("XSub update %s: %d files diffed, %d rows written, %d removed, %lld unchanged (%.0f entries/s per parse worker)."),
+	       bApplyOk ? TEXT("succeeded") : TEXT("FAILED"), DiffedFiles, Upserts.Num(), Deletes.Num(), UnchangedRows,
+	       ParseSeconds > 0.0 ? (Upserts.Num() + UnchangedRows) / ParseSeconds : 0.0);
+	return DiffedFiles;
+}
+
+void FCoDFileTracker::RunOnWorkers(int32 Num, TFunctionRef<void(int32 Index)> Body) const
+{
+	const int32 WorkerCount = FMath::Min3(Num, MaxWorkerCount, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	if (WorkerCount <= 0) return;
+	std::atomic<int32> NextIndex{0};
+	ParallelFor(WorkerCount, [this, Num, &Body, &NextIndex](int32)
+	{
+		for (int32 Index = NextIndex++; Index < Num && bShouldRun; Index = NextIndex++)
+		{
+			Body(Index);
+		}
+	}, WorkerCount < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 }
 
 TArray<FString> FCoDFileTracker::FindWniFilesToTrack() const
@@ -170,28 +403,9 @@ FString FCoDFileTracker::GetRelativePath(const FString& FullPath, const FString&
 	return FullPath;
 }
 
-uint64 FCoDFileTracker::ComputeFileContentHash(const FString& FilePath, int64 ComputeSize) const
+uint64 FCoDFileTracker::ComputeFileContentHash(const FString& FilePath) const
 {
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-
-	TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FilePath));
-	if (!FileHandle)
-	{
-		return 0;
-	}
-
-	int64 FileToReadSize = FMath::Min(ComputeSize, FileHandle->Size());
-	TArray<uint8> Buffer;
-	Buffer.SetNumUninitialized(FileToReadSize);
-	bool bSuccess = FileHandle->Read(Buffer.GetData(), FileToReadSize);
-
-	if (!bSuccess)
-	{
-		return 0;
-	}
-
-	uint64 Hash = CityHash64((const char*)Buffer.GetData(), FileToReadSize);
-	return Hash;
+	return FXSub::ComputeFingerprint(FilePath, IFileManager::Get().FileSize(*FilePath));
 }
 
 int64 FCoDFileTracker::GetFileLastModifiedTime(const FString& FilePath) const
@@ -200,247 +414,14 @@ int64 FCoDFileTracker::GetFileLastModifiedTime(const FString& FilePath) const
 	return TimeStamp.ToUnixTimestamp();
 }
 
-void FCoDFileTracker::ParseWniFile(const FString& FilePath, TMap<uint64, FString>& Items)
+bool FCoDFileTracker::ParseXSubFile(const FString& FilePath, TMap<uint64, FXSubPackageCacheObject>& Items, int64 FileId)
 {
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FilePath)) return;
-
-	FMemoryReader Ar(FileData, true);
-	uint32 Magic;
-	Ar << Magic;
-	if (Magic != 0x20494E57) // 'WNI '
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid file format: %s"), *FilePath);
-		return;
-	}
-
-	// 版本号
-	Ar.Seek(Ar.Tell() + 2);
-
-	// 条目数
-	uint32 EntryCount;
-	Ar << EntryCount;
-
-	// 压缩大小
-	uint32 PackedSize, UnpackedSize;
-	Ar << PackedSize;
-	Ar << UnpackedSize;
-
-	// 校验剩余数据大小
-	const int64 RemainingSize = Ar.TotalSize() - Ar.Tell();
-	if (RemainingSize < PackedSize)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Corrupted file: %s"), *FilePath);
-		return;
-	}
-
-	// 读取压缩数据
-	TArray<uint8> CompressedData;
-	CompressedData.SetNumUninitialized(PackedSize);
-	Ar.Serialize(CompressedData.GetData(), PackedSize);
-
-	// 准备解压缓冲区
-	TArray<uint8> DecompressedData;
-	const int32 PaddedSize = (UnpackedSize + 3) & ~3;
-	DecompressedData.SetNumUninitialized(PaddedSize);
-
-	// LZ4解压
-	bool bDecompressSuccess = FCompression::UncompressMemory(
-		NAME_LZ4,
-		DecompressedData.GetData(),
-		UnpackedSize,
-		CompressedData.GetData(),
-		CompressedData.Num(),
-		COMPRESS_NoFlags
-	);
-
-	if (!bDecompressSuccess)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Decompression failed: %s"), *FilePath);
-		return;
-	}
-
-	const uint8* StreamPtr = DecompressedData.GetData();
-	const int64 StreamLength = DecompressedData.Num();
-	int64 CurrentPos = 0;
-
-	// 验证解压后数据足够存放EntryCount
-	if (StreamLength < static_cast<int64>(EntryCount * sizeof(uint64_t)))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Corrupted decompressed data"));
-		return;
-	}
-	auto CheckBounds = [](int64 Current, int64 Needed, int64 Total)
-	{
-		if (Current + Needed > Total)
-		{
-			UE_LOG(LogTemp, Error, TEXT("Data overflow: need %lld bytes at offset %lld"), Needed, Current);
-			return false;
-		}
-		return true;
-	};
-	// 解析条目
-	for (uint32 i = 0; i < EntryCount; ++i)
-	{
-		// 1. 读取Key（小端序处理）
-		uint64 Key;
-		if (!CheckBounds(CurrentPos, sizeof(uint64), StreamLength)) break;
-
-		FMemory::Memcpy(&Key, StreamPtr + CurrentPos, sizeof(uint64));
-		// Key = FGenericPlatformMisc::NetToHost64(Key); // 正确的字节序转换
-		Key &= 0x0FFFFFFFFFFFFFFF; // 应用掩码
-		CurrentPos += sizeof(uint64);
-
-		// 2. 读取C风格字符串
-		if (!CheckBounds(CurrentPos, 1, StreamLength)) break;
-
-		FString Value;
-		const ANSICHAR* StrStart = reinterpret_cast<const ANSICHAR*>(StreamPtr + CurrentPos);
-		int32 MaxLen = StreamLength - CurrentPos;
-		int32 StrLen = 0;
-
-		// 手动查找null终止符
-		while (StrLen < MaxLen && StrStart[StrLen] != '\0')
-		{
-			StrLen++;
-		}
-
-		if (StrLen == MaxLen)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Unterminated string at entry %d"), i);
-			break;
-		}
-
-		Value = FString(StrLen, StrStart); // UTF-8转换
-		CurrentPos += StrLen + 1; // 跳过null终止符
-
-		Items.Add(Key, Value);
-	}
-}
-
-void FCoDFileTracker::ParseXSubFile(const FString& FilePath, TMap<uint64, FXSubPackageCacheObject>& Items, int64 FileId)
-{
-	TUniquePtr<IMappedFileHandle> MappedHandle(
-		FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
-	if (!MappedHandle)
-	{
-		return;
-	}
-	TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
-	if (!MappedRegion)
-	{
-		return;
-	}
-	FLargeMemoryReader Reader((MappedRegion->GetMappedPtr()), MappedRegion->GetMappedSize());
-
-	uint32 Magic = FBinaryReader::ReadUInt32(Reader);
-	uint16 Unknown1 = FBinaryReader::ReadUInt16(Reader);
-	uint16 Version = FBinaryReader::ReadUInt16(Reader);
-	uint64 Unknown = FBinaryReader::ReadUInt64(Reader);
-	uint64 Type = FBinaryReader::ReadUInt64(Reader);
-	uint64 Size = FBinaryReader::ReadUInt64(Reader);
-	FString UnknownHashes = FBinaryReader::ReadFString(Reader, 1896);
-	uint64 FileCount = FBinaryReader::ReadUInt64(Reader);
-	uint64 DataOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 DataSize = FBinaryReader::ReadUInt64(Reader);
-	uint64 HashCount = FBinaryReader::ReadUInt64(Reader);
-	uint64 HashOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 HashSize = FBinaryReader::ReadUInt64(Reader);
-	uint64 Unknown3 = FBinaryReader::ReadUInt64(Reader);
-	uint64 UnknownOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 Unknown4 = FBinaryReader::ReadUInt64(Reader);
-	uint64 IndexCount = FBinaryReader::ReadUInt64(Reader);
-	uint64 IndexOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 IndexSize = FBinaryReader::ReadUInt64(Reader);
-
-	if (Type != 3) return;
-	if (Magic != 0x4950414b || HashOffset >= static_cast<uint64>(Reader.TotalSize()))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Invalid XSub file %s"), *FilePath);
-		return;
-	}
-
-	Reader.Seek(HashOffset);
-	for (uint64 i = 0; i < HashCount; i++)
+	return FXSubParser::ParseFile(FilePath, [&Items, FileId](const FXSubParsedEntry& Entry)
 	{
-		uint64 Key = FBinaryReader::ReadUInt64(Reader);
-		uint64 PackedInfo = FBinaryReader::ReadUInt64(Reader);
-		uint32 PackedInfoEx = FBinaryReader::ReadUInt32(Reader);
-
-		FXSubPackageCacheObject CacheObject;
-		CacheObject.Offset = ((PackedInfo >> 32) << 7);
-		CacheObject.CompressedSize = ((PackedInfo >> 1) & 0x3FFFFFFF);
-
-		// 解析块头信息计算解压后尺寸
-		const int64 OriginalPos = Reader.Tell();
-		Reader.Seek(CacheObject.Offset);
-
-		// 读取块头验证Key
-		uint16 BlockHeader;
-		Reader << BlockHeader;
-		uint64 KeyFromBlock;
-		Reader << KeyFromBlock;
-
-		if (KeyFromBlock == Key)
-		{
-			Reader.Seek(CacheObject.Offset + 22);
-			uint8 BlockCount;
-			Reader << BlockCount;
-
-			uint32 TotalDecompressed = 0;
-			for (uint8 j = 0; j < BlockCount; ++j)
-			{
-				uint8 CompressionType;
-				uint32 CompressedSize, DecompressedSize;
-				Reader << CompressionType;
-				Reader << CompressedSize;
-				Reader << DecompressedSize;
-				Reader.Seek(12);
-
-				TotalDecompressed += DecompressedSize;
-			}
-			CacheObject.UncompressedSize = TotalDecompressed;
-		}
-		else
-		{
-			CacheObject.UncompressedSize = CacheObject.CompressedSize;
-		}
-
+		FXSubPackageCacheObject& CacheObject = Items.Add(Entry.Key);
 		CacheObject.FileId = FileId;
-
-		Reader.Seek(OriginalPos);
-		Items.Emplace(Key, CacheObject);
-	}
-}
-
-bool FCoDFileTracker::CheckIfFileNeedsUpdate(uint64 GameHash, const FString& RelativePath, uint64 NewContentHash,
-                                             int64 NewLastModifiedTime, int64& OutFileId)
-{
-	TOptional<IFileMetaRepository::FExistingFileInfo> ExistingInfo =
-		FileMetaRepo->QueryFileInfo(GameHash, RelativePath);
-
-	if (ExistingInfo.IsSet())
-	{
-		OutFileId = ExistingInfo->FileId;
-		if (NewContentHash == ExistingInfo->ContentHash && NewLastModifiedTime == ExistingInfo->LastModifiedTime)
-		{
-			return false;
-		}
-		FileMetaRepo->InsertOrUpdateFile(GameHash, RelativePath, NewContentHash, NewLastModifiedTime, OutFileId);
-		return true;
-	}
-	if (FileMetaRepo->InsertOrUpdateFile(GameHash, RelativePath, NewContentHash,
-	                                     NewLastModifiedTime))
-	{
-		TOptional<IFileMetaRepository::FExistingFileInfo> NewInfo =
-			FileMetaRepo->QueryFileInfo(GameHash, RelativePath);
-		if (NewInfo.IsSet())
-		{
-			OutFileId = NewInfo->FileId;
-			return true;
-		}
-	}
-	UE_LOG(LogTemp, Error, TEXT("Failed to insert FileMeta for %s"), *RelativePath);
-	OutFileId = -1;
-	return false;
+		CacheObject.Offset = Entry.Offset;
+		CacheObject.CompressedSize = Entry.CompressedSize;
+		CacheObject.UncompressedSize = Entry.UncompressedSize;
+	}) != INDEX_NONE;
 }
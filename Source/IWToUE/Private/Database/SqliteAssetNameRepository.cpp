@@ -4,6 +4,12 @@
 #include "SQLitePreparedStatement.h"
 #include "Interface/IDatabaseConnection.h"
 
+namespace
+{
+	// PRAGMA user_version from which AssetNameCache holds no rows copied from WNI files.
+	constexpr int32 WniNamesRemovedVersion = 1;
+}
+
 bool FSqliteAssetNameRepository::InsertOrUpdate(uint64 Hash, const FString& Value)
 {
 	return Connection->ExecuteStatement(
@@ -70,6 +76,44 @@ TOptional<FString> FSqliteAssetNameRepository::QueryValue(uint64 Hash)
 	return Result;
 }
 
+bool FSqliteAssetNameRepository::QueryValues(TConstArrayView<uint64> Hashes, TMap<uint64, FString>& OutValues)
+{
+	// Stay well below SQLite's default limit of 999 bound parameters per statement.
+	constexpr int32 MaxHashesPerStatement = 500;
+	bool bSuccess = true;
+	for (int32 Start = 0; Start < Hashes.Num(); Start += MaxHashesPerStatement)
+	{
+		const int32 Count = FMath::Min(MaxHashesPerStatement, Hashes.Num() - Start);
+		FString Query = TEXT("SELECT Hash, Value FROM AssetNameCache WHERE Hash IN (?");
+		for (int32 Index = 1; Index < Count; ++Index)
+		{
+			Query += TEXT(",?");
+		}
+		Query += TEXT(");");
+
+		bSuccess &= Connection->ExecuteStatement(
+			Query,
+			[&Hashes, &OutValues, Start, Count](FSQLitePreparedStatement& Stmt)
+			{
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					Stmt.SetBindingValueByIndex(Index + 1, static_cast<int64>(Hashes[Start + Index]));
+				}
+				int64 Hash = 0;
+				FString Value;
+				while (Stmt.Step() == ESQLitePreparedStatementStepResult::Row)
+				{
+					Stmt.GetColumnValueByIndex(0, Hash);
+					Stmt.GetColumnValueByIndex(1, Value);
+					OutValues.Add(static_cast<uint64>(Hash), Value);
+				}
+				return true;
+			}
+		);
+	}
+	return bSuccess;
+}
+
 bool FSqliteAssetNameRepository::DeleteByHash(uint64 Hash)
 {
 	return Connection->ExecuteStatement(
@@ -81,3 +125,85 @@ bool FSqliteAssetNameRepository::DeleteByHash(uint64 Hash)
 		}
 	);
 }
+
+int32 FSqliteAssetNameRepository::QueryCount()
+{
+	int64 Count = 0;
+	Connection->ExecuteStatement(
+		TEXT("SELECT COUNT(*) FROM AssetNameCache;"),
+		[&Count](FSQLitePreparedStatement& Stmt)
+		{
+			return Stmt.Step() == ESQLitePreparedStatementStepResult::Row && Stmt.GetColumnValueByIndex(0, Count);
+		}
+	);
+	return static_cast<int32>(Count);
+}
+
+bool FSqliteAssetNameRepository::QueryAll(TFunctionRef<void(uint64 Hash, const FString& Value)> Visitor)
+{
+	return Connection->ExecuteStatement(
+		TEXT("SELECT Hash, Value FROM AssetNameCache;"),
+		[&Visitor](FSQLitePreparedStatement& Stmt)
+		{
+			int64 Hash = 0;
+			FString Value;
+			while (Stmt.Step() == ESQLitePreparedStatementStepResult::Row)
+			{
+				Stmt.GetColumnValueByIndex(0, Hash);
+				Stmt.GetColumnValueByIndex(1, Value);
+				Visitor(static_cast<uint64>(Hash), Value);
+			}
+			return true;
+		}
+	);
+}
+
+bool FSqliteAssetNameRepository::DeleteLegacyWniNames(TFunctionRef<bool(uint64 Hash)> IsWniName)
+{
+	int64 UserVersion = 0;
+	Connection->ExecuteStatement(
+		TEXT("PRAGMA user_version;"),
+		[&UserVersion](FSQLitePreparedStatement& Stmt)
+		{
+			return Stmt.Step() == ESQLitePreparedStatementStepResult::Row && Stmt.GetColumnValueByIndex(0, UserVersion);
+		}
+	);
+	if (UserVersion >= WniNamesRemovedVersion) return true;
+
+	TArray<uint64> LegacyHashes;
+	if (!QueryAll([&IsWniName, &LegacyHashes](uint64 Hash, const FString&)
+	{
+		if (IsWniName(Hash)) LegacyHashes.Add(Hash);
+	}))
+	{
+		return false;
+	}
+
+	if (!Connection->BeginTransaction()) return false;
+	FSQLitePreparedStatement Statement(*Connection->GetRawDBPtr(), TEXT("DELETE FROM AssetNameCache WHERE Hash = ?;"));
+	bool bSuccess = Statement.IsValid();
+	for (const uint64 Hash : LegacyHashes)
+	{
+		if (!bSuccess) break;
+		Statement.Reset();
+		Statement.SetBindingValueByIndex(1, static_cast<int64>(Hash));
+		bSuccess = Statement.Execute();
+	}
+	// Bumped in the same transaction, so an interrupted migration simply runs again.
+	bSuccess = bSuccess && Connection->Execute(
+		*FString::Printf(TEXT("PRAGMA user_version = %d;"), WniNamesRemovedVersion));
+
+	if (bSuccess)
+	{
+		Connection->CommitTransaction();
+		UE_LOG(LogTemp, Log, TEXT("Removed %d asset names copied from WNI files by an older version."),
+		       LegacyHashes.Num());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to remove legacy WNI asset names: %s"),
+		       *Connection->GetRawDBPtr()->GetLastError());
+		Connection->RollbackTransaction();
+	}
+	return bSuccess;
+}
@@ -69,3 +69,132 @@ TOptional<FXSubPackageCacheObject> FSqliteXSubInfoRepository::QueryValue(uint64
 	);
 	return Result;
 }
+
+int32 FSqliteXSubInfoRepository::QueryCount()
+{
+	int64 Count = 0;
+	Connection->ExecuteStatement(
+		TEXT("SELECT COUNT(*) FROM SubFileInfo;"),
+		[&Count](FSQLitePreparedStatement& Stmt)
+		{
+			return Stmt.Step() == ESQLitePreparedStatementStepResult::Row && Stmt.GetColumnValueByIndex(0, Count);
+		}
+	);
+	return static_cast<int32>(Count);
+}
+
+bool FSqliteXSubInfoRepository::QueryAll(
+	TFunctionRef<void(uint64 DecryptionKey, const FXSubPackageCacheObject& Value)> Visitor)
+{
+	return Connection->ExecuteStatement(
+		TEXT("SELECT DecryptionKey, FileId, Offset, CompressedSize, UncompressedSize FROM SubFileInfo;"),
+		[&Visitor](FSQLitePreparedStatement& Stmt)
+		{
+			int64 DecryptionKey = 0;
+			FXSubPackageCacheObject Value;
+			while (Stmt.Step() == ESQLitePreparedStatementStepResult::Row)
+			{
+				Stmt.GetColumnValueByIndex(0, DecryptionKey);
+				Stmt.GetColumnValueByIndex(1, Value.FileId);
+				Stmt.GetColumnValueByIndex(2, Value.Offset);
+				Stmt.GetColumnValueByIndex(3, Value.CompressedSize);
+				Stmt.GetColumnValueByIndex(4, Value.UncompressedSize);
+				Visitor(static_cast<uint64>(DecryptionKey), Value);
+			}
+			return true;
+		}
+	);
+}
+
+bool FSqliteXSubInfoRepository::QueryFilePaths(TFunctionRef<void(int64 FileId, const FString& AbsolutePath)> Visitor)
+{
+	return Connection->ExecuteStatement(
+		TEXT(R"(SELECT Meta.FileId, (Games.GamePath || '/' || Meta.Path) AS AbsolutePath
+			FROM FileMeta AS Meta
+			INNER JOIN Games ON Meta.GameHash = Games.GameHash;)"),
+		[&Visitor](FSQLitePreparedStatement& Stmt)
+		{
+			int64 FileId = 0;
+			FString AbsolutePath;
+			while (Stmt.Step() == ESQLitePreparedStatementStepResult::Row)
+			{
+				Stmt.GetColumnValueByIndex(0, FileId);
+				Stmt.GetColumnValueByIndex(1, AbsolutePath);
+				Visitor(FileId, AbsolutePath);
+			}
+			return true;
+		}
+	);
+}
+
+bool FSqliteXSubInfoRepository::QueryByFile(int64 FileId, TMap<uint64, FXSubPackageCacheObject>& OutItems)
+{
+	return Connection->ExecuteStatement(
+		TEXT("SELECT DecryptionKey, Offset, CompressedSize, UncompressedSize FROM SubFileInfo WHERE FileId = ?;"),
+		[FileId, &OutItems](FSQLitePreparedStatement& Stmt)
+		{
+			Stmt.SetBindingValueByIndex(1, FileId);
+			int64 DecryptionKey = 0;
+			FXSubPackageCacheObject Value;
+			Value.FileId = FileId;
+			while (Stmt.Step() == ESQLitePreparedStatementStepResult::Row)
+			{
+				Stmt.GetColumnValueByIndex(0, DecryptionKey);
+				Stmt.GetColumnValueByIndex(1, Value.Offset);
+				Stmt.GetColumnValueByIndex(2, Value.CompressedSize);
+				Stmt.GetColumnValueByIndex(3, Value.UncompressedSize);
+				OutItems.Add(static_cast<uint64>(DecryptionKey), Value);
+			}
+			return true;
+		}
+	);
+}
+
+bool FSqliteXSubInfoRepository::ApplyChanges(const TMap<uint64, FXSubPackageCacheObject>& Upserts,
+                                             TConstArrayView<uint64> Deletes)
+{
+	if (Upserts.Num() == 0 && Deletes.Num() == 0) return true;
+	if (!Connection->BeginTransaction()) return false;
+
+	bool bSuccess = true;
+	if (Deletes.Num() > 0)
+	{
+		FSQLitePreparedStatement Statement(*Connection->GetRawDBPtr(),
+		                                   TEXT("DELETE FROM SubFileInfo WHERE DecryptionKey = ?;"));
+		bSuccess = Statement.IsValid();
+		for (int32 i = 0; bSuccess && i < Deletes.Num(); ++i)
+		{
+			Statement.Reset();
+			Statement.SetBindingValueByIndex(1, static_cast<int64>(Deletes[i]));
+			bSuccess = Statement.Execute();
+		}
+	}
+	if (bSuccess && Upserts.Num() > 0)
+	{
+		FSQLitePreparedStatement Statement(*Connection->GetRawDBPtr(),
+		                                   TEXT(
+			                                   "INSERT OR REPLACE INTO SubFileInfo (FileId, DecryptionKey, Offset, CompressedSize, UncompressedSize) VALUES (?, ?, ?, ?, ?);"));
+		bSuccess = Statement.IsValid();
+		for (auto It = Upserts.CreateConstIterator(); bSuccess && It; ++It)
+		{
+			Statement.Reset();
+			Statement.SetBindingValueByIndex(1, It.Value().FileId);
+			Statement.SetBindingValueByIndex(2, It.Key());
+			Statement.SetBindingValueByIndex(3, It.Value().Offset);
+			Statement.SetBindingValueByIndex(4, It.Value().CompressedSize);
+			Statement.SetBindingValueByIndex(5, It.Value().UncompressedSize);
+			bSuccess = Statement.Execute();
+		}
+	}
+
+	if (bSuccess)
+	{
+		Connection->CommitTransaction();
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Applying XSub changes failed: %s"), *Connection->GetRawDBPtr()->GetLastError());
+		Connection->RollbackTransaction();
+	}
+	return bSuccess;
+}
@@ -0,0 +1,94 @@
+﻿#include "Database/XSubInfoIndex.h"
+
+#include "MapImporter/XSub.h"
+#include "Algo/BinarySearch.h"
+
+FXSubInfoIndex::FXSubInfoIndex(int32 ExpectedCount)
+{
+	Keys.Reserve(ExpectedCount);
+	Entries.Reserve(ExpectedCount);
+}
+
+void FXSubInfoIndex::AddFile(int64 FileId, const FString& Path)
+{
+	if (!FileIndexById.Contains(FileId))
+	{
+		FileIndexById.Add(FileId, Files.Add({FileId, Path}));
+	}
+}
+
+void FXSubInfoIndex::Add(uint64 DecryptionKey, int64 FileId, uint64 Offset, uint64 CompressedSize,
+                         uint64 UncompressedSize)
+{
+	const int32* FileIndex = FileIndexById.Find(FileId);
+	if (!FileIndex)
+	{
+		// Rows whose file has no known path could never be read anyway.
+		return;
+	}
+	Keys.Add(DecryptionKey);
+	Entries.Add({Offset, CompressedSize, UncompressedSize, *FileIndex});
+}
+
+void FXSubInfoIndex::Finalize()
+{
+	TArray<int32> Order;
+	Order.SetNumUninitialized(Keys.Num());
+	for (int32 i = 0; i < Order.Num(); ++i)
+	{
+		Order[i] = i;
+	}
+	Order.Sort([this](int32 A, int32 B) { return Keys[A] < Keys[B]; });
+
+	TArray<uint64> SortedKeys;
+	TArray<FEntry> SortedEntries;
+	SortedKeys.Reserve(Order.Num());
+	SortedEntries.Reserve(Order.Num());
+	for (const int32 Index : Order)
+	{
+		// DecryptionKey is the table's primary key, so duplicates only come from misuse; keep the first.
+		if (SortedKeys.Num() > 0 && SortedKeys.Last() == Keys[Index])
+		{
+			continue;
+		}
+		SortedKeys.Add(Keys[Index]);
+		SortedEntries.Add(Entries[Index]);
+	}
+	Keys = MoveTemp(SortedKeys);
+	Entries = MoveTemp(SortedEntries);
+	FileIndexById.Empty();
+}
+
+int32 FXSubInfoIndex::FindIndex(uint64 DecryptionKey) const
+{
+	return Algo::BinarySearch(Keys, DecryptionKey);
+}
+
+TOptional<FXSubPackageCacheObject> FXSubInfoIndex::Find(uint64 DecryptionKey) const
+{
+	const int32 Index = FindIndex(DecryptionKey);
+	if (Index == INDEX_NONE)
+	{
+		return TOptional<FXSubPackageCacheObject>();
+	}
+	const FEntry& Entry = Entries[Index];
+	const FFile& File = Files[Entry.FileIndex];
+
+	FXSubPackageCacheObject Value;
+	Value.FileId = File.FileId;
+	Value.Offset = Entry.Offset;
+	Value.CompressedSize = Entry.CompressedSize;
+	Value.UncompressedSize = Entry.UncompressedSize;
+	Value.Path = File.Path;
+	return Value;
+}
+
+SIZE_T FXSubInfoIndex::GetAllocatedSize() const
+{
+	SIZE_T Size = Keys.GetAllocatedSize() + Entries.GetAllocatedSize() + Files.GetAllocatedSize();
+	for (const FFile& File : Files)
+	{
+		Size += File.Path.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -126,38 +126,50 @@ int32 FModernWarfare5AssetDiscoverer::DiscoverAssetsInPool(const FAssetPoolDefin
 			{
 			case EWraithAssetType::Model:
 				{
-					DiscoverModelAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverModelAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Image:
 				{
-					DiscoverImageAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverImageAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Animation:
 				{
-					DiscoverAnimAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverAnimAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Material:
 				{
-					DiscoverMaterialAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverMaterialAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Sound:
 				{
-					DiscoverSoundAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverSoundAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Map:
 				{
-					DiscoverMapAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverMapAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			default:
@@ -196,14 +208,14 @@ bool FModernWarfare5AssetDiscoverer::ReadAssetNode(uint64 AssetNodePtr, FXAsset6
 	return Reader->ReadMemory<FXAsset64>(AssetNodePtr, OutAssetNode);
 }
 
-void FModernWarfare5AssetDiscoverer::DiscoverModelAssets(FXAsset64 AssetNode,
+bool FModernWarfare5AssetDiscoverer::DiscoverModelAssets(FXAsset64 AssetNode,
                                                          FAssetDiscoveredDelegate OnAssetDiscovered)
 {
 	FMW5XModel ModelHeader;
 	if (!Reader->ReadMemory<FMW5XModel>(AssetNode.Header, ModelHeader))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Failed to read XModel header at 0x%llX"), AssetNode.Header);
-		return;
+		return false;
 	}
 	uint64 ModelHash = ModelHeader.Hash & 0xFFFFFFFFFFFFFFF;
 
@@ -247,12 +259,13 @@ void FModernWarfare5AssetDiscoverer::DiscoverModelAssets(FXAsset64 AssetNode,
 					            : FString::Printf(TEXT("xmodel_%llx"), ModelHash));
 			});
 	}
+	return true;
 }
 
-void FModernWarfare5AssetDiscoverer::DiscoverImageAssets(FXAsset64 AssetNode,
+bool FModernWarfare5AssetDiscoverer::DiscoverImageAssets(FXAsset64 AssetNode,
                                                          FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW5GfxImage, FCoDImage>(
+	return ProcessGenericAssetNode<FMW5GfxImage, FCoDImage>(
 	Reader, AssetNode, EWraithAssetType::Image, TEXT("ximage"),
 	[](const FMW5GfxImage& ImageHeader, TSharedPtr<FCoDImage> LoadedImage)
 	{
@@ -266,9 +279,9 @@ void FModernWarfare5AssetDiscoverer::DiscoverImageAssets(FXAsset64 AssetNode,
 );
 }
 
-void FModernWarfare5AssetDiscoverer::DiscoverAnimAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
+bool FModernWarfare5AssetDiscoverer::DiscoverAnimAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW5XAnim, FCoDAnim>(
+	return ProcessGenericAssetNode<FMW5XAnim, FCoDAnim>(
 	Reader, AssetNode, EWraithAssetType::Animation, TEXT("xanim"),
 	[](const FMW5XAnim& Anim, TSharedPtr<FCoDAnim> LoadedAnim)
 	{
@@ -281,10 +294,10 @@ void FModernWarfare5AssetDiscoverer::DiscoverAnimAssets(FXAsset64 AssetNode, FAs
 );
 }
 
-void FModernWarfare5AssetDiscoverer::DiscoverMaterialAssets(FXAsset64 AssetNode,
+bool FModernWarfare5AssetDiscoverer::DiscoverMaterialAssets(FXAsset64 AssetNode,
                                                             FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW5XMaterial, FCoDMaterial>(
+	return ProcessGenericAssetNode<FMW5XMaterial, FCoDMaterial>(
 	Reader, AssetNode, EWraithAssetType::Material, TEXT("xmaterial"),
 	[](const FMW5XMaterial& Material, TSharedPtr<FCoDMaterial> LoadedMaterial)
 	{
@@ -295,10 +308,10 @@ void FModernWarfare5AssetDiscoverer::DiscoverMaterialAssets(FXAsset64 AssetNode,
 );
 }
 
-void FModernWarfare5AssetDiscoverer::DiscoverSoundAssets(FXAsset64 AssetNode,
+bool FModernWarfare5AssetDiscoverer::DiscoverSoundAssets(FXAsset64 AssetNode,
                                                          FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW5SoundAsset, FCoDSound>(
+	return ProcessGenericAssetNode<FMW5SoundAsset, FCoDSound>(
 		Reader, AssetNode, EWraithAssetType::Sound, TEXT("xsound"),
 		[](const FMW5SoundAsset& Sound, TSharedPtr<FCoDSound> LoadedSound)
 		{
@@ -327,9 +340,9 @@ void FModernWarfare5AssetDiscoverer::DiscoverSoundAssets(FXAsset64 AssetNode,
 }
 
 // 测试 mp_embassy
-void FModernWarfare5AssetDiscoverer::DiscoverMapAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
+bool FModernWarfare5AssetDiscoverer::DiscoverMapAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW5GfxWorld, FCoDMap>(
+	return ProcessGenericAssetNode<FMW5GfxWorld, FCoDMap>(
 		Reader, AssetNode, EWraithAssetType::Map, TEXT("xmap"),
 		[this](const FMW5GfxWorld& WorldHeader, TSharedPtr<FCoDMap> LoadedMap)
 		{
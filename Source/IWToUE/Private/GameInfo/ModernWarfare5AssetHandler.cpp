@@ -150,22 +150,40 @@ bool ModernWarfare5AssetHandler::ReadAnimData(TSharedPtr<FCoDAnim> AnimInfo, FWr
 	OutAnim.NotificationCount = AnimData.NotetrackCount;
 	OutAnim.ReaderInformationPointer = AnimInfo->AssetPointer;
 
-	for (int32 BoneIdx = 0; BoneIdx < AnimData.TotalBoneCount; ++BoneIdx)
+	TArray<uint32> BoneNameHashes;
+	if (MemoryReader->ReadArray(AnimData.BoneIDsPtr, BoneNameHashes, AnimData.TotalBoneCount))
 	{
-		uint32 BoneNameHash;
-		MemoryReader->ReadMemory<uint32>(AnimData.BoneIDsPtr + BoneIdx * 4, BoneNameHash);
-		FString BoneName = FCoDDatabaseService::Get().GetPrintfAssetName(BoneNameHash, "Bone");
-		OutAnim.Reader.BoneNames.Add(BoneName);
+		TArray<uint64> BoneHashes(BoneNameHashes);
+		FCoDDatabaseService::Get().ResolveNamesBatch(BoneHashes, OutAnim.Reader.BoneNames, TEXT("Bone"));
+	}
+	else
+	{
+		// ReadAnimData indexes BoneNames by bone, so keep one entry per bone even without the hashes.
+		UE_LOG(LogTemp, Warning, TEXT("Failed to read bone IDs for animation %s, using placeholder names."),
+		       *OutAnim.AnimationName);
+		OutAnim.Reader.BoneNames.Reset(AnimData.TotalBoneCount);
+		for (int32 BoneIdx = 0; BoneIdx < AnimData.TotalBoneCount; ++BoneIdx)
+		{
+			OutAnim.Reader.BoneNames.Add(FString::Printf(TEXT("Bone_%d"), BoneIdx));
+		}
 	}
 
-	for (int32 NoteTrackIdx = 0; NoteTrackIdx < AnimData.NotetrackCount; ++NoteTrackIdx)
+	TArray<FMW5XAnimNoteTrack> NoteTracks;
+	if (MemoryReader->ReadArray(AnimData.NotificationsPtr, NoteTracks, AnimData.NotetrackCount))
 	{
-		FMW5XAnimNoteTrack NoteTrack;
-		MemoryReader->ReadMemory<FMW5XAnimNoteTrack>(
-			AnimData.NotificationsPtr + NoteTrackIdx * sizeof(FMW5XAnimNoteTrack), NoteTrack);
-		FString TrackName;
-		MemoryReader->ReadString(GameProcess->ParasyteState->StringsAddress + NoteTrack.Name, TrackName);
-		OutAnim.Reader.Notetracks.Emplace(TrackName, NoteTrack.Time * OutAnim.FrameCount);
+		TArray<uint64> TrackNameAddresses;
+		TrackNameAddresses.Reserve(NoteTracks.Num());
+		for (const FMW5XAnimNoteTrack& NoteTrack : NoteTracks)
+		{
+			TrackNameAddresses.Add(GameProcess->ParasyteState->StringsAddress + NoteTrack.Name);
+		}
+		TArray<FString> TrackNames;
+		MemoryReader->ReadStrings(TrackNameAddresses, TrackNames);
+		for (int32 NoteTrackIdx = 0; NoteTrackIdx < NoteTracks.Num(); ++NoteTrackIdx)
+		{
+			OutAnim.Reader.Notetracks.Emplace(TrackNames[NoteTrackIdx],
+			                                  NoteTracks[NoteTrackIdx].Time * OutAnim.FrameCount);
+		}
 	}
 
 	FMW5XAnimDeltaParts AnimDeltaData;
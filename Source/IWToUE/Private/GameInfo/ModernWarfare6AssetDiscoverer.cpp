@@ -126,38 +126,50 @@ int32 FModernWarfare6AssetDiscoverer::DiscoverAssetsInPool(const FAssetPoolDefin
 			{
 			case EWraithAssetType::Model:
 				{
-					DiscoverModelAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverModelAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Image:
 				{
-					DiscoverImageAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverImageAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Animation:
 				{
-					DiscoverAnimAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverAnimAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Material:
 				{
-					DiscoverMaterialAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverMaterialAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Sound:
 				{
-					DiscoverSoundAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverSoundAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			case EWraithAssetType::Map:
 				{
-					DiscoverMapAssets(CurrentNode, OnAssetDiscovered);
-					DiscoveredCount++;
+					if (DiscoverMapAssets(CurrentNode, OnAssetDiscovered))
+					{
+						DiscoveredCount++;
+					}
 					break;
 				}
 			default:
@@ -196,14 +208,14 @@ bool FModernWarfare6AssetDiscoverer::ReadAssetNode(uint64 AssetNodePtr, FXAsset6
 	return Reader->ReadMemory<FXAsset64>(AssetNodePtr, OutAssetNode);
 }
 
-void FModernWarfare6AssetDiscoverer::DiscoverModelAssets(FXAsset64 AssetNode,
+bool FModernWarfare6AssetDiscoverer::DiscoverModelAssets(FXAsset64 AssetNode,
                                                          FAssetDiscoveredDelegate OnAssetDiscovered)
 {
 	FMW6XModel ModelHeader;
 	if (!Reader->ReadMemory<FMW6XModel>(AssetNode.Header, ModelHeader))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Failed to read XModel header at 0x%llX"), AssetNode.Header);
-		return;
+		return false;
 	}
 	uint64 ModelHash = ModelHeader.Hash & 0xFFFFFFFFFFFFFFF;
 
@@ -245,12 +257,13 @@ void FModernWarfare6AssetDiscoverer::DiscoverModelAssets(FXAsset64 AssetNode,
 					            : FString::Printf(TEXT("xmodel_%llx"), ModelHash));
 			});
 	}
+	return true;
 }
 
-void FModernWarfare6AssetDiscoverer::DiscoverImageAssets(FXAsset64 AssetNode,
+bool FModernWarfare6AssetDiscoverer::DiscoverImageAssets(FXAsset64 AssetNode,
                                                          FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW6GfxImage, FCoDImage>(
+	return ProcessGenericAssetNode<FMW6GfxImage, FCoDImage>(
 		Reader, AssetNode, EWraithAssetType::Image, TEXT("ximage"),
 		[](const FMW6GfxImage& ImageHeader, TSharedPtr<FCoDImage> LoadedImage)
 		{
@@ -264,9 +277,9 @@ void FModernWarfare6AssetDiscoverer::DiscoverImageAssets(FXAsset64 AssetNode,
 	);
 }
 
-void FModernWarfare6AssetDiscoverer::DiscoverAnimAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
+bool FModernWarfare6AssetDiscoverer::DiscoverAnimAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW6XAnim, FCoDAnim>(
+	return ProcessGenericAssetNode<FMW6XAnim, FCoDAnim>(
 		Reader, AssetNode, EWraithAssetType::Animation, TEXT("xanim"),
 		[](const FMW6XAnim& Anim, TSharedPtr<FCoDAnim> LoadedAnim)
 		{
@@ -279,10 +292,10 @@ void FModernWarfare6AssetDiscoverer::DiscoverAnimAssets(FXAsset64 AssetNode, FAs
 	);
 }
 
-void FModernWarfare6AssetDiscoverer::DiscoverMaterialAssets(FXAsset64 AssetNode,
+bool FModernWarfare6AssetDiscoverer::DiscoverMaterialAssets(FXAsset64 AssetNode,
                                                             FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW6Material, FCoDMaterial>(
+	return ProcessGenericAssetNode<FMW6Material, FCoDMaterial>(
 		Reader, AssetNode, EWraithAssetType::Material, TEXT("xmaterial"),
 		[](const FMW6Material& Material, TSharedPtr<FCoDMaterial> LoadedMaterial)
 		{
@@ -293,10 +306,10 @@ void FModernWarfare6AssetDiscoverer::DiscoverMaterialAssets(FXAsset64 AssetNode,
 	);
 }
 
-void FModernWarfare6AssetDiscoverer::DiscoverSoundAssets(FXAsset64 AssetNode,
+bool FModernWarfare6AssetDiscoverer::DiscoverSoundAssets(FXAsset64 AssetNode,
                                                          FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW6SoundAsset, FCoDSound>(
+	return ProcessGenericAssetNode<FMW6SoundAsset, FCoDSound>(
 		Reader, AssetNode, EWraithAssetType::Sound, TEXT("xsound"),
 		[](const FMW6SoundAsset& Sound, TSharedPtr<FCoDSound> LoadedSound)
 		{
@@ -324,9 +337,9 @@ void FModernWarfare6AssetDiscoverer::DiscoverSoundAssets(FXAsset64 AssetNode,
 	);
 }
 
-void FModernWarfare6AssetDiscoverer::DiscoverMapAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
+bool FModernWarfare6AssetDiscoverer::DiscoverMapAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered)
 {
-	ProcessGenericAssetNode<FMW6GfxWorld, FCoDMap>(
+	return ProcessGenericAssetNode<FMW6GfxWorld, FCoDMap>(
 		Reader, AssetNode, EWraithAssetType::Map, TEXT("xmap"),
 		[this](const FMW6GfxWorld& WorldHeader, TSharedPtr<FCoDMap> LoadedMap)
 		{
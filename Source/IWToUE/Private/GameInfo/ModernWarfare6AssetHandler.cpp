@@ -145,22 +145,40 @@ bool FModernWarfare6AssetHandler::ReadAnimData(TSharedPtr<FCoDAnim> AnimInfo, FW
 	OutAnim.NotificationCount = AnimData.NotetrackCount;
 	OutAnim.ReaderInformationPointer = AnimInfo->AssetPointer;
 
-	for (int32 BoneIdx = 0; BoneIdx < AnimData.TotalBoneCount; ++BoneIdx)
+	TArray<uint32> BoneNameHashes;
+	if (MemoryReader->ReadArray(AnimData.BoneIDsPtr, BoneNameHashes, AnimData.TotalBoneCount))
 	{
-		uint32 BoneNameHash;
-		MemoryReader->ReadMemory<uint32>(AnimData.BoneIDsPtr + BoneIdx * 4, BoneNameHash);
-		FString BoneName = FCoDDatabaseService::Get().GetPrintfAssetName(BoneNameHash, "Bone");
-		OutAnim.Reader.BoneNames.Add(BoneName);
+		TArray<uint64> BoneHashes(BoneNameHashes);
+		FCoDDatabaseService::Get().ResolveNamesBatch(BoneHashes, OutAnim.Reader.BoneNames, TEXT("Bone"));
+	}
+	else
+	{
+		// ReadAnimData indexes BoneNames by bone, so keep one entry per bone even without the hashes.
+		UE_LOG(LogTemp, Warning, TEXT("Failed to read bone IDs for animation %s, using placeholder names."),
+		       *OutAnim.AnimationName);
+		OutAnim.Reader.BoneNames.Reset(AnimData.TotalBoneCount);
+		for (int32 BoneIdx = 0; BoneIdx < AnimData.TotalBoneCount; ++BoneIdx)
+		{
+			OutAnim.Reader.BoneNames.Add(FString::Printf(TEXT("Bone_%d"), BoneIdx));
+		}
 	}
 
-	for (int32 NoteTrackIdx = 0; NoteTrackIdx < AnimData.NotetrackCount; ++NoteTrackIdx)
+	TArray<FMW6XAnimNoteTrack> NoteTracks;
+	if (MemoryReader->ReadArray(AnimData.NotificationsPtr, NoteTracks, AnimData.NotetrackCount))
 	{
-		FMW6XAnimNoteTrack NoteTrack;
-		MemoryReader->ReadMemory<FMW6XAnimNoteTrack>(
-			AnimData.NotificationsPtr + NoteTrackIdx * sizeof(FMW6XAnimNoteTrack), NoteTrack);
-		FString TrackName;
-		MemoryReader->ReadString(GameProcess->ParasyteState->StringsAddress + NoteTrack.Name, TrackName);
-		OutAnim.Reader.Notetracks.Emplace(TrackName, NoteTrack.Time * OutAnim.FrameCount);
+		TArray<uint64> TrackNameAddresses;
+		TrackNameAddresses.Reserve(NoteTracks.Num());
+		for (const FMW6XAnimNoteTrack& NoteTrack : NoteTracks)
+		{
+			TrackNameAddresses.Add(GameProcess->ParasyteState->StringsAddress + NoteTrack.Name);
+		}
+		TArray<FString> TrackNames;
+		MemoryReader->ReadStrings(TrackNameAddresses, TrackNames);
+		for (int32 NoteTrackIdx = 0; NoteTrackIdx < NoteTracks.Num(); ++NoteTrackIdx)
+		{
+			OutAnim.Reader.Notetracks.Emplace(TrackNames[NoteTrackIdx],
+			                                  NoteTracks[NoteTrackIdx].Time * OutAnim.FrameCount);
+		}
 	}
 
 	FMW6XAnimDeltaParts AnimDeltaData;
@@ -452,6 +470,10 @@ bool FModernWarfare6AssetHandler::ReadMapData(TSharedPtr<FCoDMap> MapInfo, FWrai
 	FMW6GfxWorldSurfaces& Surfaces = WorldData.Surfaces;
 	OutMapData.MapMeshes.Reserve(Surfaces.Count);
 
+	const uint64 SurfaceStartCycles = FPlatformTime::Cycles64();
+	uint64 TotalSurfaceReads = 0;
+	FMapSurfaceBuffers SurfaceBuffers;
+
 	for (uint32 SurfaceIdx = 0; SurfaceIdx < Surfaces.Count; ++SurfaceIdx)
 	{
 		FMW6GfxSurface GfxSurface;
@@ -482,109 +504,14 @@ bool FModernWarfare6AssetHandler::ReadMapData(TSharedPtr<FCoDMap> MapInfo, FWrai
 		MeshInfo.MaterialHash = (MaterialData.Hash & 0xFFFFFFFFFFFFFFF);
 		MeshInfo.MaterialPtr = MaterialPtr;
 
-		// --- Read Vertex Data ---
-		uint16 VertexCount = GfxSurface.VertexCount;
-		MeshInfo.UVLayer = FMath::Max(UgbSurfData.LayerCount, 0u);
-		MeshInfo.VertexPositions.Reserve(VertexCount);
-		MeshInfo.VertexNormals.Reserve(VertexCount);
-		MeshInfo.VertexTangents.Reserve(VertexCount);
-
-		MeshInfo.VertexUVs.SetNum(UgbSurfData.LayerCount);
-		for (uint32 i = 0; i < UgbSurfData.LayerCount; i++)
-		{
-			MeshInfo.VertexUVs[i].Reserve(VertexCount);
-		}
-
-		if (UgbSurfData.ColorOffset != 0) MeshInfo.VertexColor.Reserve(VertexCount);
-
-		uint64 XyzPtr = Zone.DrawVerts.PosData + UgbSurfData.XyzOffset;
-		uint64 TangentFramePtr = Zone.DrawVerts.PosData + UgbSurfData.TangentFrameOffset;
-		uint64 TexCoordPtr = Zone.DrawVerts.PosData + UgbSurfData.TexCoordOffset;
-		uint64 ColorPtr = (UgbSurfData.ColorOffset != 0) ? (Zone.DrawVerts.PosData + UgbSurfData.ColorOffset) : 0;
-
-		FMW6GfxWorldDrawOffset WorldDrawOffset = UgbSurfData.WorldDrawOffset;
-
-
-		for (uint16 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-		{
-			uint64 PackedPosition;
-			if (!MemoryReader->ReadMemory<uint64>(XyzPtr + VertexIdx * sizeof(uint64), PackedPosition)) continue;
-			FVector3f Position{
-				((PackedPosition >> 0) & 0x1FFFFF) * WorldDrawOffset.Scale + WorldDrawOffset.X,
-				((PackedPosition >> 21) & 0x1FFFFF) * WorldDrawOffset.Scale + WorldDrawOffset.Y,
-				((PackedPosition >> 42) & 0x1FFFFF) * WorldDrawOffset.Scale + WorldDrawOffset.Z
-			};
-			MeshInfo.VertexPositions.Add(Position);
-
-			// Tangent Frame (Normal/Tangent)
-			uint32 PackedTangentFrame;
-			if (!MemoryReader->ReadMemory<uint32>(TangentFramePtr + VertexIdx * sizeof(uint32), PackedTangentFrame))
-				continue;
-			FVector3f Tangent, Normal;
-			FCoDMeshHelper::UnpackCoDQTangent(PackedTangentFrame, Tangent, Normal);
-			MeshInfo.VertexTangents.Add(Tangent);
-			MeshInfo.VertexNormals.Add(Normal);
-
-			// UVs
-			for (uint32 LayerIdx = 0; LayerIdx < UgbSurfData.LayerCount; ++LayerIdx)
-			{
-				uint64 CurrentLayerUVPtr = TexCoordPtr + sizeof(FVector2f) * (VertexIdx * UgbSurfData.LayerCount +
-					LayerIdx);
-				FVector2f LayerUV;
-				MemoryReader->ReadMemory<FVector2f>(CurrentLayerUVPtr, LayerUV);
-				MeshInfo.VertexUVs[LayerIdx].Add(MoveTemp(LayerUV));
-			}
-
-			// Color
-			if (ColorPtr != 0)
-			{
-				// uint32 PackedColor;
-				// if (!MemoryReader->ReadMemory<uint32>(ColorPtr + VertexIdx * sizeof(uint32), PackedColor)) continue;
-				// MeshInfo.VertexColor.Add(PackedColor);
-			}
-		}
-
-		// --- Read Face Indices ---
-		uint64 TableOffsetPtr = Zone.DrawVerts.TableData + GfxSurface.TableIndex * 40;
-		uint64 IndicesPtr = Zone.DrawVerts.Indices + GfxSurface.BaseIndex * sizeof(uint16);
-		uint64 PackedIndicesPtr = Zone.DrawVerts.PackedIndices + GfxSurface.PackedIndicesOffset;
-
-		MeshInfo.Faces.Reserve(GfxSurface.TriCount * 3);
-
-		for (int TriIndex = 0; TriIndex < GfxSurface.TriCount; ++TriIndex)
-		{
-			TArray<uint16> FaceIndices;
-			if (!FCoDMeshHelper::UnpackFaceIndices(MemoryReader,
-			                                       FaceIndices, TableOffsetPtr,
-			                                       GfxSurface.PackedIndicesTableCount,
-			                                       PackedIndicesPtr, IndicesPtr, TriIndex, false))
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Failed to unpack faces for surface %d, triangle %d."), SurfaceIdx,
-				       TriIndex);
-				MeshInfo.Faces.SetNum(0);
-				break;
-			}
-
-			if (FaceIndices.Num() == 3)
-			{
-				MeshInfo.Faces.Add(FaceIndices[2]);
-				MeshInfo.Faces.Add(FaceIndices[1]);
-				MeshInfo.Faces.Add(FaceIndices[0]);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("UnpackFaceIndices returned %d indices for triangle %d (expected 3)."),
-				       FaceIndices.Num(), TriIndex);
-				MeshInfo.Faces.SetNum(0);
-				break;
-			}
-		}
+		const bool bSurfaceRead = ReadMapSurface(GfxSurface, UgbSurfData, Zone, SurfaceBuffers, MeshInfo);
+		TotalSurfaceReads += SurfaceBuffers.ReadCount;
 
-		if (MeshInfo.Faces.Num() != GfxSurface.TriCount * 3)
+		if (!bSurfaceRead || MeshInfo.Faces.Num() != GfxSurface.TriCount * 3)
 		{
-			OutMapData.MapMeshes.Pop();
-			UE_LOG(LogTemp, Error, TEXT("Removed invalid mesh chunk %s due to face reading errors."),
+			UE_LOG(LogTemp, Error, TEXT("Removed invalid mesh chunk %s due to surface reading errors."),
 			       *MeshChunk.MeshName);
+			OutMapData.MapMeshes.Pop();
 		}
 		else
 		{
@@ -593,6 +520,10 @@ bool FModernWarfare6AssetHandler::ReadMapData(TSharedPtr<FCoDMap> MapInfo, FWrai
 		}
 	}
 
+	const double SurfaceDurationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SurfaceStartCycles);
+	UE_LOG(LogTemp, Verbose, TEXT("Read %d map surfaces in %.2f ms (%.1f reads per surface)."), Surfaces.Count,
+	       SurfaceDurationMs, Surfaces.Count > 0 ? static_cast<double>(TotalSurfaceReads) / Surfaces.Count : 0.0);
+
 	// --- Process Static Model Instances ---
 	UE_LOG(LogTemp, Log, TEXT("Processing %d static model collections..."), WorldData.SModels.CollectionsCount);
 	FMW6GfxWorldStaticModels& SModels = WorldData.SModels;
@@ -679,6 +610,107 @@ bool FModernWarfare6AssetHandler::ReadMapData(TSharedPtr<FCoDMap> MapInfo, FWrai
 	return true;
 }
 
+bool FModernWarfare6AssetHandler::ReadMapSurface(const FMW6GfxSurface& GfxSurface,
+                                                 const FMW6GfxUgbSurfData& UgbSurfData,
+                                                 const FMW6GfxWorldTransientZone& Zone,
+                                                 FMapSurfaceBuffers& Buffers, FCastMeshInfo& OutMeshInfo)
+{
+	const uint32 VertexCount = GfxSurface.VertexCount;
+	const uint32 LayerCount = UgbSurfData.LayerCount;
+	const uint32 TableCount = GfxSurface.PackedIndicesTableCount;
+	const uint32 IndexCount = GfxSurface.TriCount * 3;
+	const uint64 PosData = Zone.DrawVerts.PosData;
+	Buffers.ReadCount = 0;
+
+	// --- Vertex Streams: one read per stream ---
+	Buffers.ReadCount += 3;
+	if (!MemoryReader->ReadArray(PosData + UgbSurfData.XyzOffset, Buffers.Positions, VertexCount) ||
+		!MemoryReader->ReadArray(PosData + UgbSurfData.TangentFrameOffset, Buffers.TangentFrames, VertexCount) ||
+		!MemoryReader->ReadArray(PosData + UgbSurfData.TexCoordOffset, Buffers.TexCoords, VertexCount * LayerCount))
+	{
+		return false;
+	}
+
+	// --- Index Streams: tables first, they bound the packed index range ---
+	Buffers.ReadCount += 1;
+	if (!MemoryReader->ReadArray(Zone.DrawVerts.TableData + GfxSurface.TableIndex * 40, Buffers.Tables,
+	                             TableCount * 40))
+	{
+		return false;
+	}
+	const uint64 PackedIndicesSize = FCoDMeshHelper::GetPackedIndicesSize(Buffers.Tables.GetData(), TableCount);
+	Buffers.ReadCount += 1;
+	if (!MemoryReader->ReadArray(Zone.DrawVerts.PackedIndices + GfxSurface.PackedIndicesOffset,
+	                             Buffers.PackedIndices, PackedIndicesSize))
+	{
+		return false;
+	}
+
+	Buffers.FaceOffsets.SetNumUninitialized(IndexCount, EAllowShrinking::No);
+	uint32 MaxFaceOffset = 0;
+	for (uint32 TriIndex = 0; TriIndex < GfxSurface.TriCount; ++TriIndex)
+	{
+		uint32* TriOffsets = Buffers.FaceOffsets.GetData() + TriIndex * 3;
+		if (!FCoDMeshHelper::UnpackFaceOffsetsLocal(Buffers.Tables.GetData(), TableCount,
+		                                            Buffers.PackedIndices.GetData(), TriIndex, TriOffsets))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to unpack faces for triangle %d."), TriIndex);
+			return false;
+		}
+		MaxFaceOffset = FMath::Max3(MaxFaceOffset, FMath::Max(TriOffsets[0], TriOffsets[1]), TriOffsets[2]);
+	}
+
+	Buffers.ReadCount += 1;
+	if (!MemoryReader->ReadArray(Zone.DrawVerts.Indices + GfxSurface.BaseIndex * sizeof(uint16), Buffers.Indices,
+	                             MaxFaceOffset + 1))
+	{
+		return false;
+	}
+
+	// --- Decode Vertices ---
+	const FMW6GfxWorldDrawOffset& WorldDrawOffset = UgbSurfData.WorldDrawOffset;
+	OutMeshInfo.UVLayer = LayerCount;
+	OutMeshInfo.VertexPositions.Reserve(VertexCount);
+	OutMeshInfo.VertexNormals.Reserve(VertexCount);
+	OutMeshInfo.VertexTangents.Reserve(VertexCount);
+	OutMeshInfo.VertexUVs.SetNum(LayerCount);
+	for (uint32 LayerIdx = 0; LayerIdx < LayerCount; ++LayerIdx)
+	{
+		OutMeshInfo.VertexUVs[LayerIdx].Reserve(VertexCount);
+	}
+
+	for (uint32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+	{
+		const uint64 PackedPosition = Buffers.Positions[VertexIdx];
+		OutMeshInfo.VertexPositions.Emplace(
+			((PackedPosition >> 0) & 0x1FFFFF) * WorldDrawOffset.Scale + WorldDrawOffset.X,
+			((PackedPosition >> 21) & 0x1FFFFF) * WorldDrawOffset.Scale + WorldDrawOffset.Y,
+			((PackedPosition >> 42) & 0x1FFFFF) * WorldDrawOffset.Scale + WorldDrawOffset.Z);
+
+		// Tangent Frame (Normal/Tangent)
+		FVector3f Tangent, Normal;
+		FCoDMeshHelper::UnpackCoDQTangent(Buffers.TangentFrames[VertexIdx], Tangent, Normal);
+		OutMeshInfo.VertexTangents.Add(Tangent);
+		OutMeshInfo.VertexNormals.Add(Normal);
+
+		// UVs are interleaved per vertex
+		for (uint32 LayerIdx = 0; LayerIdx < LayerCount; ++LayerIdx)
+		{
+			OutMeshInfo.VertexUVs[LayerIdx].Add(Buffers.TexCoords[VertexIdx * LayerCount + LayerIdx]);
+		}
+	}
+
+	// --- Decode Faces ---
+	OutMeshInfo.Faces.SetNumUninitialized(IndexCount);
+	for (uint32 Index = 0; Index < IndexCount; Index += 3)
+	{
+		OutMeshInfo.Faces[Index] = Buffers.Indices[Buffers.FaceOffsets[Index + 2]];
+		OutMeshInfo.Faces[Index + 1] = Buffers.Indices[Buffers.FaceOffsets[Index + 1]];
+		OutMeshInfo.Faces[Index + 2] = Buffers.Indices[Buffers.FaceOffsets[Index]];
+	}
+	return true;
+}
+
 bool FModernWarfare6AssetHandler::TranslateAnim(const FWraithXAnim& InAnim, FCastAnimationInfo& OutAnimInfo)
 {
 	OutAnimInfo.Name = InAnim.AnimationName;
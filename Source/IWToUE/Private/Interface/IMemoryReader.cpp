@@ -0,0 +1,122 @@
+﻿#include "Interface/IMemoryReader.h"
+
+#include "SeLogChannels.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+bool IMemoryReader::IsLocalRangeReadable(const void* Address, SIZE_T Size)
+{
+#if PLATFORM_WINDOWS
+	return !IsBadReadPtr(Address, Size);
+#else
+	return Address != nullptr;
+#endif
+}
+
+bool IMemoryReader::ReadString(uint64 Address, FString& OutString, int MaxLength)
+{
+	OutString.Empty();
+	if (!IsValid() || Address == 0) return false;
+
+	// Scratch buffer is per thread so concurrent readers neither lock nor reallocate per string.
+	thread_local TArray<ANSICHAR> StringBuffer;
+	if (!ReadNullTerminatedString(Address, StringBuffer, MaxLength))
+	{
+		OutString.Empty();
+		return false;
+	}
+
+	OutString = FString(StringBuffer.Num(), StringBuffer.GetData());
+
+	return true;
+}
+
+int32 IMemoryReader::ReadStrings(TConstArrayView<uint64> Addresses, TArray<FString>& OutStrings, int MaxLength)
+{
+	OutStrings.Reset();
+	OutStrings.SetNum(Addresses.Num());
+
+	TArray<int32> Order;
+	Order.Reserve(Addresses.Num());
+	for (int32 Index = 0; Index < Addresses.Num(); ++Index)
+	{
+		Order.Add(Index);
+	}
+	Order.Sort([&Addresses](int32 A, int32 B) { return Addresses[A] < Addresses[B]; });
+
+	// Strings are resolved in address order so neighbours (string tables, name pools) share one page read.
+	ANSICHAR Page[StringPageSize];
+	uint64 LoadedPage = 0;
+	bool bPageLoaded = false;
+	int32 ReadCount = 0;
+
+	for (const int32 Index : Order)
+	{
+		const uint64 Address = Addresses[Index];
+		if (Address == 0) continue;
+
+		const uint64 PageAddress = Address & ~(StringPageSize - 1);
+		if (PageAddress != LoadedPage)
+		{
+			LoadedPage = PageAddress;
+			bPageLoaded = ReadMemoryImpl(PageAddress, Page, StringPageSize);
+		}
+
+		if (bPageLoaded)
+		{
+			const uint64 Offset = Address - PageAddress;
+			const uint64 ScanSize = FMath::Min<uint64>(StringPageSize - Offset, MaxLength);
+			if (const ANSICHAR* Terminator = static_cast<const ANSICHAR*>(memchr(Page + Offset, 0, ScanSize)))
+			{
+				OutStrings[Index] = FString(static_cast<int32>(Terminator - (Page + Offset)), Page + Offset);
+				++ReadCount;
+				continue;
+			}
+		}
+
+		// Crosses the page boundary or the page is only partially readable.
+		if (ReadString(Address, OutStrings[Index], MaxLength))
+		{
+			++ReadCount;
+		}
+	}
+	return ReadCount;
+}
+
+bool IMemoryReader::ReadNullTerminatedString(uint64 Address, TArray<ANSICHAR>& OutBuffer, int32 MaxLength)
+{
+	OutBuffer.Reset();
+
+	// Most names are short, so the first read is small; later reads fetch the rest of the current page.
+	ANSICHAR Chunk[StringPageSize];
+	uint64 CurrentAddress = Address;
+	uint64 ChunkLimit = FirstStringChunkSize;
+
+	while (OutBuffer.Num() < MaxLength)
+	{
+		// Chunks never cross a page boundary, so a string ending right before an unmapped page still reads.
+		const uint64 ToPageEnd = StringPageSize - (CurrentAddress & (StringPageSize - 1));
+		const uint64 ChunkSize = FMath::Min3(ToPageEnd, ChunkLimit, static_cast<uint64>(MaxLength - OutBuffer.Num()));
+		if (!ReadMemoryImpl(CurrentAddress, Chunk, ChunkSize))
+		{
+			return OutBuffer.Num() > 0;
+		}
+
+		if (const ANSICHAR* Terminator = static_cast<const ANSICHAR*>(memchr(Chunk, 0, ChunkSize)))
+		{
+			OutBuffer.Append(Chunk, static_cast<int32>(Terminator - Chunk));
+			return true;
+		}
+
+		OutBuffer.Append(Chunk, static_cast<int32>(ChunkSize));
+		CurrentAddress += ChunkSize;
+		ChunkLimit = StringPageSize;
+	}
+
+	UE_LOG(LogITUMemoryReader, Warning, TEXT("String at 0x%llX exceeded MaxLength (%d)"), Address, MaxLength);
+	return true;
+}
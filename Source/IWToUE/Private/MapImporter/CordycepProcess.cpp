@@ -102,7 +102,9 @@ TArray<TSharedPtr<FCastMapInfo>> FCordycepProcess::GetMapsInfo()
 
 FString FCordycepProcess::ReadFString(uint64 Address)
 {
-	TArray<uint8> Data;
+	// Reused per thread so concurrent surface workers don't allocate for every name.
+	thread_local TArray<uint8> Data;
+	Data.Reset();
 	while (true)
 	{
 		uint8 Tmp = ReadMemory<uint8>(Address);
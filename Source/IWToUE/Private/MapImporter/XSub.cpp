@@ -4,8 +4,12 @@
 #include "Utils/BinaryReader.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
+#include "Hash/xxhash.h"
 #include "oodle2.h"
 #include "Database/CoDDatabaseService.h"
+#include "MapImporter/XSubParser.h"
+#include "Utils/FileHandlePool.h"
+#include "Utils/ScratchBuffer.h"
 
 FXSub::FXSub(uint64 GameID, const FString& GamePath)
 {
@@ -62,18 +66,16 @@ void FXSub::LoadFiles()
 		if (!NeedsReload(FileRelativePath)) return;
 
 		TMap<uint64, FXSubPackageCacheObject> LocalCache;
-
-		TUniquePtr<IMappedFileHandle> MappedHandle(
-			FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FileAbsolutePath));
-		if (MappedHandle)
+		FXSubParser::ParseFile(FileAbsolutePath, [&](const FXSubParsedEntry& Entry)
 		{
-			TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
-			if (MappedRegion)
-			{
-				FLargeMemoryReader Reader((MappedRegion->GetMappedPtr()), MappedRegion->GetMappedSize());
-				ReadXSub(Reader, FileRelativePath, Index, LocalCache);
-			}
-		}
+			FXSubPackageCacheObject CacheObject;
+			CacheObject.FileId = 0;
+			CacheObject.Offset = Entry.Offset;
+			CacheObject.CompressedSize = Entry.CompressedSize;
+			CacheObject.UncompressedSize = Entry.UncompressedSize;
+			CacheObject.Path = FileRelativePath;
+			LocalCache.Emplace(Entry.Key, MoveTemp(CacheObject));
+		});
 
 		// 线程安全合并缓存
 		{
@@ -97,88 +99,6 @@ void FXSub::LoadFiles()
 	}
 }
 
-void FXSub::ReadXSub(FLargeMemoryReader& Reader, const FString& FilePath, int32 FileIndex,
-                     TMap<uint64, FXSubPackageCacheObject>& LocalCache)
-{
-	uint32 Magic = FBinaryReader::ReadUInt32(Reader);
-	uint16 Unknown1 = FBinaryReader::ReadUInt16(Reader);
-	uint16 Version = FBinaryReader::ReadUInt16(Reader);
-	uint64 Unknown = FBinaryReader::ReadUInt64(Reader);
-	uint64 Type = FBinaryReader::ReadUInt64(Reader);
-	uint64 Size = FBinaryReader::ReadUInt64(Reader);
-	FString UnknownHashes = FBinaryReader::ReadFString(Reader, 1896);
-	uint64 FileCount = FBinaryReader::ReadUInt64(Reader);
-	uint64 DataOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 DataSize = FBinaryReader::ReadUInt64(Reader);
-	uint64 HashCount = FBinaryReader::ReadUInt64(Reader);
-	uint64 HashOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 HashSize = FBinaryReader::ReadUInt64(Reader);
-	uint64 Unknown3 = FBinaryReader::ReadUInt64(Reader);
-	uint64 UnknownOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 Unknown4 = FBinaryReader::ReadUInt64(Reader);
-	uint64 IndexCount = FBinaryReader::ReadUInt64(Reader);
-	uint64 IndexOffset = FBinaryReader::ReadUInt64(Reader);
-	uint64 IndexSize = FBinaryReader::ReadUInt64(Reader);
-
-	if (Type != 3) return;
-	if (Magic != 0x4950414b || HashOffset >= static_cast<uint64>(Reader.TotalSize()))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Invalid XSub file %s"), *FilePath);
-		return;
-	}
-
-	Reader.Seek(HashOffset);
-	for (uint64 i = 0; i < HashCount; i++)
-	{
-		uint64 Key = FBinaryReader::ReadUInt64(Reader);
-		uint64 PackedInfo = FBinaryReader::ReadUInt64(Reader);
-		uint32 PackedInfoEx = FBinaryReader::ReadUInt32(Reader);
-
-		FXSubPackageCacheObject CacheObject;
-		CacheObject.Offset = ((PackedInfo >> 32) << 7);
-		CacheObject.CompressedSize = ((PackedInfo >> 1) & 0x3FFFFFFF);
-		CacheObject.Path = FilePath;
-
-		// 解析块头信息计算解压后尺寸
-		const int64 OriginalPos = Reader.Tell();
-		Reader.Seek(CacheObject.Offset);
-
-		// 读取块头验证Key
-		uint16 BlockHeader;
-		Reader << BlockHeader;
-		uint64 KeyFromBlock;
-		Reader << KeyFromBlock;
-
-		if (KeyFromBlock == Key)
-		{
-			Reader.Seek(CacheObject.Offset + 22);
-			uint8 BlockCount;
-			Reader << BlockCount;
-
-			uint32 TotalDecompressed = 0;
-			for (uint8 j = 0; j < BlockCount; ++j)
-			{
-				uint8 CompressionType;
-				uint32 CompressedSize, DecompressedSize;
-				Reader << CompressionType;
-				Reader << CompressedSize;
-				Reader << DecompressedSize;
-				Reader.Seek(12);
-
-				TotalDecompressed += DecompressedSize;
-			}
-			CacheObject.UncompressedSize = TotalDecompressed;
-		}
-		else
-		{
-			CacheObject.UncompressedSize = CacheObject.CompressedSize;
-		}
-
-		Reader.Seek(OriginalPos);
-		LocalCache.Emplace(Key, CacheObject);
-	}
-}
-
 TArray<uint8> FXSub::ExtractXSubPackage(uint64 Key, uint32 Size)
 {
 	FRWScopeLock ReadLock(CacheLock, SLT_ReadOnly);
@@ -191,108 +111,109 @@ TArray<uint8> FXSub::ExtractXSubPackage(uint64 Key, uint32 Size)
 	}
 	FXSubPackageCacheObject CacheObject = ResObj.GetValue();
 
-	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*CacheObject.Path, FILEREAD_Silent));
-	if (!Reader)
+	// The whole package is read once through a pooled handle; block tables and block data are then parsed from memory.
+	const FScratchBuffer PackageData = FScratchBuffer::Acquire(CacheObject.CompressedSize);
+	if (!FFileHandlePool::Get().ReadAt(CacheObject.Path, CacheObject.Offset, PackageData.GetData(),
+	                                   CacheObject.CompressedSize))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to open file: %s"), *CacheObject.Path);
+		UE_LOG(LogTemp, Warning, TEXT("Failed to read package %llx from %s"), Key, *CacheObject.Path);
 		return TArray<uint8>();
 	}
 
-	const uint32 BufferSize = Size > 0 ? Size : 0x2400000;
-	TArray<uint8> DecompressedData;
-	DecompressedData.AddUninitialized(BufferSize);
-
-	uint64 BlockPosition = CacheObject.Offset;
-	const uint64 BlockEnd = CacheObject.Offset + CacheObject.CompressedSize;
-
-	Reader->Seek(BlockPosition + 2);
-
 	// 验证密钥
-	uint64 FileKey;
-	*Reader << FileKey;
+	uint64 FileKey = 0;
+	if (PackageData.Num() >= 10)
+	{
+		FMemory::Memcpy(&FileKey, PackageData.GetData() + 2, sizeof(uint64));
+	}
 	if (FileKey != Key)
 	{
-		Reader->Seek(BlockPosition);
-		TArray<uint8> RawData;
-		RawData.SetNumUninitialized(CacheObject.CompressedSize);
-		Reader->Serialize(RawData.GetData(), CacheObject.CompressedSize);
-		return RawData;
+		return TArray<uint8>(PackageData.GetData(), static_cast<int32>(PackageData.Num()));
 	}
 
-	TArray<FXSubBlock> Blocks;
-	TArray<uint8> CompressedData;
-	uint64 BlockDataSize = 0;
-
-	while (BlockPosition < BlockEnd)
+	// A package is a sequence of 0x80-aligned groups, each with its own block table.
+	struct FPendingBlock
 	{
-		// 读取块信息
-		Reader->Seek(BlockPosition + 22);
-		uint8 BlockCount;
-		*Reader << BlockCount;
-
-		Blocks.SetNum(BlockCount, EAllowShrinking::No);
+		FXSubBlock Block;
+		uint64 DataOffset;
+	};
+	TArray<FPendingBlock> PendingBlocks;
+	uint64 OutputSize = 0;
+	uint64 BlockPosition = 0;
+	const uint64 BlockEnd = PackageData.Num();
+
+	while (BlockPosition + 23 <= BlockEnd)
+	{
+		const uint8 BlockCount = PackageData.GetData()[BlockPosition + 22];
+		uint64 TablePosition = BlockPosition + 23;
+		uint64 GroupEnd = TablePosition;
 		for (int32 i = 0; i < BlockCount; ++i)
 		{
-			auto& [CompressionType, CompressedSize, DecompressedSize, BlockOffset, DecompressedOffset, Unknown]
-				= Blocks[i];
-			*Reader << CompressionType;
-			*Reader << CompressedSize;
-			*Reader << DecompressedSize;
-			*Reader << BlockOffset;
-			*Reader << DecompressedOffset;
-			*Reader << Unknown;
+			if (TablePosition + 21 > BlockEnd) break;
+			FPendingBlock& Pending = PendingBlocks.AddDefaulted_GetRef();
+			FXSubBlock& Block = Pending.Block;
+			const uint8* Entry = PackageData.GetData() + TablePosition;
+			Block.CompressionType = Entry[0];
+			FMemory::Memcpy(&Block.CompressedSize, Entry + 1, sizeof(uint32));
+			FMemory::Memcpy(&Block.DecompressedSize, Entry + 5, sizeof(uint32));
+			FMemory::Memcpy(&Block.BlockOffset, Entry + 9, sizeof(uint32));
+			FMemory::Memcpy(&Block.DecompressedOffset, Entry + 13, sizeof(uint32));
+			FMemory::Memcpy(&Block.Unknown, Entry + 17, sizeof(uint32));
+			TablePosition += 21;
+
+			Pending.DataOffset = BlockPosition + Block.BlockOffset;
+			GroupEnd = Pending.DataOffset + Block.CompressedSize;
+			OutputSize = FMath::Max<uint64>(OutputSize, static_cast<uint64>(Block.DecompressedOffset) +
+			                                Block.DecompressedSize);
 		}
+		BlockPosition = (GroupEnd + 0x7F) & ~0x7F;
+	}
 
-		// 处理每个数据块
-		for (int32 i = 0; i < BlockCount; ++i)
-		{
-			const FXSubBlock& Block = Blocks[i];
-
-			// 定位到块数据位置
-			Reader->Seek(BlockPosition + Block.BlockOffset);
+	TArray<uint8> DecompressedData;
+	DecompressedData.SetNumUninitialized(FMath::Max<uint64>(OutputSize, Size));
 
-			// 读取压缩数据
-			CompressedData.SetNumUninitialized(Block.CompressedSize, EAllowShrinking::No);
-			Reader->Serialize(CompressedData.GetData(), Block.CompressedSize);
+	// Blocks write to disjoint ranges of the output, so they are decoded in parallel.
+	std::atomic<uint64> BlockDataSize{0};
+	ParallelFor(PendingBlocks.Num(), [&](int32 Index)
+	{
+		const FXSubBlock& Block = PendingBlocks[Index].Block;
+		if (PendingBlocks[Index].DataOffset + Block.CompressedSize > BlockEnd)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Block %d of package %llx exceeds the package size"), Index, Key);
+			return;
+		}
 
-			const uint8* CompressedBlockPtr = CompressedData.GetData();
-			uint8* DecompressedPtr = DecompressedData.GetData() + Block.DecompressedOffset;
+		const uint8* CompressedBlockPtr = PackageData.GetData() + PendingBlocks[Index].DataOffset;
+		uint8* DecompressedPtr = DecompressedData.GetData() + Block.DecompressedOffset;
 
-			switch (Block.CompressionType)
+		switch (Block.CompressionType)
+		{
+		case 6:
 			{
-			case 6:
-				{
-					BlockDataSize += OodleLZ_Decompress(CompressedBlockPtr,
-					                                    Block.CompressedSize,
-					                                    DecompressedPtr,
-					                                    Block.DecompressedSize,
-					                                    OodleLZ_FuzzSafe_No,
-					                                    OodleLZ_CheckCRC_No,
-					                                    OodleLZ_Verbosity_None,
-					                                    nullptr,
-					                                    0,
-					                                    nullptr,
-					                                    nullptr,
-					                                    nullptr,
-					                                    0,
-					                                    OodleLZ_Decode_ThreadPhaseAll);
-				}
-				break;
-			default:
-				UE_LOG(LogTemp, Warning, TEXT("Unknown compression type %d"), Block.CompressionType);
-				break;
+				const OO_SINTa Decoded = OodleLZ_Decompress(CompressedBlockPtr,
+				                                            Block.CompressedSize,
+				                                            DecompressedPtr,
+				                                            Block.DecompressedSize,
+				                                            OodleLZ_FuzzSafe_No,
+				                                            OodleLZ_CheckCRC_No,
+				                                            OodleLZ_Verbosity_None,
+				                                            nullptr,
+				                                            0,
+				                                            nullptr,
+				                                            nullptr,
+				                                            nullptr,
+				                                            0,
+				                                            OodleLZ_Decode_ThreadPhaseAll);
+				BlockDataSize += Decoded;
 			}
+			break;
+		default:
+			UE_LOG(LogTemp, Warning, TEXT("Unknown compression type %d"), Block.CompressionType);
+			break;
 		}
+	}, PendingBlocks.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-		const int64 CurrentPos = Reader->Tell();
-		BlockPosition = (CurrentPos + 0x7F) & ~0x7F;
-		if (CurrentPos != BlockPosition)
-		{
-			Reader->Seek(BlockPosition);
-		}
-	}
-
-	DecompressedData.SetNum(BlockDataSize);
+	DecompressedData.SetNum(BlockDataSize.load());
 	return DecompressedData;
 }
 
@@ -375,3 +296,36 @@ FString FXSub::ComputeOptimizedHash(const FString& FilePath)
 	FSHA1::HashBuffer(HeadData.GetData(), SampleSize, Hash.Hash);
 	return Hash.ToString();
 }
+
+uint64 FXSub::ComputeFingerprint(const FString& FilePath, int64 FileSize)
+{
+	constexpr int64 PrefixSize = 64 * 1024;
+	constexpr int64 SampleSize = 4 * 1024;
+	constexpr int32 SampleCount = 4;
+
+	TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!FileHandle) return 0;
+
+	FXxHash64Builder Builder;
+	Builder.Update(&FileSize, sizeof(FileSize));
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(PrefixSize);
+	const int64 HeadSize = FMath::Min(FileSize, PrefixSize);
+	if (!FileHandle->Read(Buffer.GetData(), HeadSize)) return 0;
+	Builder.Update(Buffer.GetData(), HeadSize);
+
+	// XSub tables live near the end of the file, so the last sample ends exactly at EOF.
+	if (FileSize > PrefixSize)
+	{
+		const int64 Remaining = FileSize - PrefixSize;
+		for (int32 i = 1; i <= SampleCount; ++i)
+		{
+			const int64 Offset = PrefixSize + FMath::Max<int64>(Remaining * i / SampleCount - SampleSize, 0);
+			const int64 Size = FMath::Min(SampleSize, FileSize - Offset);
+			if (!FileHandle->Seek(Offset) || !FileHandle->Read(Buffer.GetData(), Size)) return 0;
+			Builder.Update(Buffer.GetData(), Size);
+		}
+	}
+	return Builder.Finalize().Hash;
+}
@@ -0,0 +1,81 @@
+﻿#include "MapImporter/XSubParser.h"
+
+#include "Async/MappedFileHandle.h"
+#include "CDN/XSubCacheV3.h"
+#include "HAL/PlatformFileManager.h"
+
+static_assert(sizeof(FXSubHeaderV2) == 2024, "FXSubHeaderV2 must match the on-disk header layout");
+
+int64 FXSubParser::ParseFile(const FString& FilePath, TFunctionRef<void(const FXSubParsedEntry& Entry)> Sink)
+{
+	TUniquePtr<IMappedFileHandle> MappedHandle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (!MappedHandle)
+	{
+		return INDEX_NONE;
+	}
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	if (!MappedRegion)
+	{
+		return INDEX_NONE;
+	}
+	return Parse(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), FilePath, Sink);
+}
+
+int64 FXSubParser::Parse(const uint8* Data, int64 DataSize, const FString& FilePath,
+                         TFunctionRef<void(const FXSubParsedEntry& Entry)> Sink)
+{
+	if (DataSize < static_cast<int64>(sizeof(FXSubHeaderV2)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid XSub file %s"), *FilePath);
+		return INDEX_NONE;
+	}
+	FXSubHeaderV2 Header;
+	FMemory::Memcpy(&Header, Data, sizeof(FXSubHeaderV2));
+
+	if (Header.Type != PackageType) return 0;
+	if (Header.Magic != XSubMagic || Header.HashOffset >= static_cast<uint64>(DataSize) ||
+		Header.HashCount > (DataSize - Header.HashOffset) / HashEntrySize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid XSub file %s"), *FilePath);
+		return INDEX_NONE;
+	}
+
+	const uint8* HashEntry = Data + Header.HashOffset;
+	for (uint64 i = 0; i < Header.HashCount; ++i, HashEntry += HashEntrySize)
+	{
+		FXSubParsedEntry Entry;
+		uint64 PackedInfo;
+		FMemory::Memcpy(&Entry.Key, HashEntry, sizeof(uint64));
+		FMemory::Memcpy(&PackedInfo, HashEntry + 8, sizeof(uint64));
+		Entry.Offset = (PackedInfo >> 32) << 7;
+		Entry.CompressedSize = (PackedInfo >> 1) & 0x3FFFFFFF;
+		Entry.UncompressedSize = GetUncompressedSize(Data, DataSize, Entry.Key, Entry.Offset, Entry.CompressedSize);
+		Sink(Entry);
+	}
+	return Header.HashCount;
+}
+
+uint64 FXSubParser::GetUncompressedSize(const uint8* Data, int64 DataSize, uint64 Key, uint64 Offset,
+                                        uint64 CompressedSize)
+{
+	// 读取块头验证Key；不匹配的包未压缩
+	if (Offset + 23 > static_cast<uint64>(DataSize)) return CompressedSize;
+	uint64 KeyFromBlock;
+	FMemory::Memcpy(&KeyFromBlock, Data + Offset + 2, sizeof(uint64));
+	if (KeyFromBlock != Key) return CompressedSize;
+
+	// 21-byte block entries: type, compressed size, decompressed size, block offset, decompressed offset, unknown.
+	const uint8 BlockCount = Data[Offset + 22];
+	const uint8* Block = Data + Offset + 23;
+	const uint8* BlockTableEnd = Block + BlockCount * 21;
+	if (BlockTableEnd > Data + DataSize) return CompressedSize;
+
+	uint64 TotalDecompressed = 0;
+	for (; Block < BlockTableEnd; Block += 21)
+	{
+		uint32 DecompressedSize;
+		FMemory::Memcpy(&DecompressedSize, Block + 5, sizeof(uint32));
+		TotalDecompressed += DecompressedSize;
+	}
+	return TotalDecompressed;
+}
@@ -9,6 +9,7 @@
 #include "Importers/MaterialImporter.h"
 #include "Importers/ModelImporter.h"
 #include "Importers/SoundImporter.h"
+#include "Utils/FileHandlePool.h"
 #include "WraithX/CoDAssetType.h"
 #include "WraithX/GameProcess.h"
 #include "WraithX/WraithSettingsManager.h"
@@ -288,6 +289,8 @@ void FAssetImportManager::RunImportTask(FString BaseImportPath, TArray<TSharedPt
 		CompletedAssets++;
 	}
 
+	FFileHandlePool::Get().LogStats();
+
 	if (bOverallSuccess)
 	{
 		AsyncTask(ENamedThreads::GameThread, [this]()
@@ -777,6 +777,78 @@ bool FCoDMeshHelper::UnpackFaceIndices(TSharedPtr<IMemoryReader>& MemoryReader,
 	return false;
 }
 
+namespace
+{
+	uint8 GetPackedIndexBitCount(uint8 Bits)
+	{
+		unsigned long BitIndex;
+		if (!_BitScanReverse64(&BitIndex, Bits)) return 0;
+		return static_cast<uint8>(BitIndex + 1);
+	}
+
+	struct FPackedIndexTable
+	{
+		uint32 FaceIndex;
+		uint8 Bits;
+		uint8 Count;
+		uint32 IndicesOffset;
+	};
+
+	FPackedIndexTable ReadPackedIndexTable(const uint8* Tables, uint64 TableIdx)
+	{
+		const uint8* TablePtr = Tables + TableIdx * 40;
+		FPackedIndexTable Table;
+		FMemory::Memcpy(&Table.FaceIndex, TablePtr + 28, sizeof(uint32));
+		Table.Bits = TablePtr[34];
+		Table.Count = TablePtr[35];
+		FMemory::Memcpy(&Table.IndicesOffset, TablePtr + 36, sizeof(uint32));
+		return Table;
+	}
+}
+
+uint64 FCoDMeshHelper::GetPackedIndicesSize(const uint8* Tables, uint64 TableCount)
+{
+	uint64 Size = 0;
+	for (uint64 i = 0; i < TableCount; i++)
+	{
+		const FPackedIndexTable Table = ReadPackedIndexTable(Tables, i);
+		const uint64 BitCount = GetPackedIndexBitCount(Table.Bits - 1);
+		Size = FMath::Max(Size, Table.IndicesOffset + (Table.Count * 3 * BitCount + 7) / 8);
+	}
+	return Size;
+}
+
+bool FCoDMeshHelper::UnpackFaceOffsetsLocal(const uint8* Tables, uint64 TableCount, const uint8* PackedIndices,
+                                            uint64 FaceIndex, uint32 OutFaceOffsets[3])
+{
+	uint64 CurrentFaceIndex = FaceIndex;
+	for (uint64 i = 0; i < TableCount; i++)
+	{
+		const FPackedIndexTable Table = ReadPackedIndexTable(Tables, i);
+		if (CurrentFaceIndex < Table.Count)
+		{
+			const uint8 BitCount = GetPackedIndexBitCount(Table.Bits - 1);
+			const uint8* IndicesPtr = PackedIndices + Table.IndicesOffset;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 BitPosition = static_cast<uint32>(CurrentFaceIndex * 3 + Corner) * BitCount;
+				const uint8* BytePtr = IndicesPtr + (BitPosition >> 3);
+				const uint8 BitOffset = BitPosition & 7;
+
+				uint32 Value = BytePtr[0] >> BitOffset;
+				if (8 - BitOffset < BitCount)
+				{
+					Value |= static_cast<uint32>(BytePtr[1]) << (8 - BitOffset);
+				}
+				OutFaceOffsets[Corner] = (Value & ((1u << BitCount) - 1)) + Table.FaceIndex;
+			}
+			return true;
+		}
+		CurrentFaceIndex -= Table.Count;
+	}
+	return false;
+}
+
 void FCoDMeshHelper::UnpackCoDQTangent(const uint32 Packed, FVector3f& Tangent, FVector3f& Normal)
 {
 	uint32 Idx = Packed >> 30;
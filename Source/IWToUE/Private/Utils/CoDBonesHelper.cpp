@@ -47,19 +47,24 @@ void CoDBonesHelper::ReadXModelBones(TSharedPtr<IMemoryReader>& MemoryReader, co
 	static_assert(sizeof(FVector4f) == 16, "FVector4f must be 16 bytes!");
 	MemoryReader->ReadArray(BaseModel.RotationsPtr, BoneLocalRotationArray, ChildBoneSize);
 
+	// 骨骼名
+	TArray<uint64> BoneNameHashes;
+	BoneNameHashes.Reserve(BoneCount);
+	Visit([&](auto& InBoneHashArray)
+	{
+		for (uint32 BoneIdx = 0; BoneIdx < BoneCount; ++BoneIdx)
+		{
+			BoneNameHashes.Add(InBoneHashArray[BoneIdx]);
+		}
+	}, BoneHashVariant);
+	TArray<FString> BoneNames;
+	FCoDDatabaseService::Get().ResolveNamesBatch(BoneNameHashes, BoneNames, TEXT("bone"));
+
 	for (uint32 BoneIdx = 0; BoneIdx < BaseModel.BoneCount; ++BoneIdx)
 	{
 		FCastBoneInfo& Bone = SkeletonInfo.Bones.AddDefaulted_GetRef();
 
-		// 骨骼名
-		uint32 BoneNameHash;
-		auto HashVisitor = [&](auto& InBoneHashArray)
-		{
-			BoneNameHash = InBoneHashArray[BoneIdx];
-		};
-		Visit(HashVisitor, BoneHashVariant);
-
-		Bone.BoneName = FCoDDatabaseService::Get().GetPrintfAssetName(BoneNameHash,"bone");
+		Bone.BoneName = BoneNames[BoneIdx];
 
 		// 骨骼父节点
 		if (BoneIdx >= BaseModel.RootBoneCount)
@@ -0,0 +1,124 @@
+﻿#include "Utils/FileHandlePool.h"
+
+#include "HAL/PlatformFileManager.h"
+
+FFileHandlePool& FFileHandlePool::Get()
+{
+	static FFileHandlePool Instance;
+	return Instance;
+}
+
+bool FFileHandlePool::ReadAt(const FString& Path, int64 Offset, void* Dest, int64 Size)
+{
+	if (Size <= 0)
+	{
+		return Size == 0;
+	}
+	TSharedPtr<IFileHandle> Handle = Acquire(Path);
+	if (!Handle)
+	{
+		return false;
+	}
+	ReadCount.fetch_add(1, std::memory_order_relaxed);
+	return Handle->ReadAt(static_cast<uint8*>(Dest), Size, Offset);
+}
+
+int64 FFileHandlePool::GetFileSize(const FString& Path)
+{
+	TSharedPtr<IFileHandle> Handle = Acquire(Path);
+	return Handle ? Handle->Size() : -1;
+}
+
+void FFileHandlePool::Release(const FString& Path)
+{
+	FScopeLock Lock(&PoolLock);
+	if (Handles.Remove(Path) > 0)
+	{
+		CloseCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void FFileHandlePool::ReleaseAll()
+{
+	FScopeLock Lock(&PoolLock);
+	CloseCount.fetch_add(Handles.Num(), std::memory_order_relaxed);
+	Handles.Empty();
+}
+
+FFileHandlePool::FStats FFileHandlePool::GetStats() const
+{
+	FStats Stats;
+	Stats.Opens = OpenCount.load(std::memory_order_relaxed);
+	Stats.Closes = CloseCount.load(std::memory_order_relaxed);
+	Stats.Reads = ReadCount.load(std::memory_order_relaxed);
+	Stats.OpenSeconds = FPlatformTime::ToSeconds64(OpenCycles.load(std::memory_order_relaxed));
+	return Stats;
+}
+
+void FFileHandlePool::LogStats() const
+{
+	const FStats Stats = GetStats();
+	UE_LOG(LogTemp, Log, TEXT("File handle pool: %llu reads, %llu opens (%.3f ms total), %llu closes."),
+	       Stats.Reads, Stats.Opens, Stats.OpenSeconds * 1000.0, Stats.Closes);
+}
+
+TSharedPtr<IFileHandle> FFileHandlePool::Acquire(const FString& Path)
+{
+	{
+		FScopeLock Lock(&PoolLock);
+		if (FEntry* Entry = Handles.Find(Path))
+		{
+			Entry->LastUse = ++UseCounter;
+			return Entry->Handle;
+		}
+	}
+
+	// Open outside the lock so a slow open does not stall readers of other files.
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	TSharedPtr<IFileHandle> NewHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path, true));
+	OpenCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	if (!NewHandle)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to open file: %s"), *Path);
+		return nullptr;
+	}
+	OpenCount.fetch_add(1, std::memory_order_relaxed);
+
+	FScopeLock Lock(&PoolLock);
+	if (FEntry* Entry = Handles.Find(Path))
+	{
+		// Another thread opened the same file first; keep its handle.
+		CloseCount.fetch_add(1, std::memory_order_relaxed);
+		Entry->LastUse = ++UseCounter;
+		return Entry->Handle;
+	}
+	if (Handles.Num() >= MaxOpenHandles)
+	{
+		EvictLeastRecentlyUsed();
+	}
+	FEntry& Entry = Handles.Add(Path);
+	Entry.Handle = NewHandle;
+	Entry.LastUse = ++UseCounter;
+	return NewHandle;
+}
+
+void FFileHandlePool::EvictLeastRecentlyUsed()
+{
+	const FString* OldestPath = nullptr;
+	uint64 OldestUse = MAX_uint64;
+	for (const TPair<FString, FEntry>& Pair : Handles)
+	{
+		if (Pair.Value.LastUse < OldestUse)
+		{
+			OldestUse = Pair.Value.LastUse;
+			OldestPath = &Pair.Key;
+		}
+	}
+	if (OldestPath)
+	{
+		// In-flight readers hold their own reference, so the handle closes once they finish.
+		const FString PathToEvict = *OldestPath;
+		Handles.Remove(PathToEvict);
+		CloseCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
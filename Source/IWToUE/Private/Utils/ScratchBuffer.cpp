@@ -0,0 +1,124 @@
+﻿#include "Utils/ScratchBuffer.h"
+
+namespace
+{
+	int64 GetClassSize(int32 SizeClass)
+	{
+		return FScratchBuffer::MinClassSize << SizeClass;
+	}
+
+	int32 GetSizeClass(int64 Size)
+	{
+		for (int32 SizeClass = 0; SizeClass < FScratchBuffer::NumSizeClasses; ++SizeClass)
+		{
+			if (Size <= GetClassSize(SizeClass))
+			{
+				return SizeClass;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	struct FThreadScratchCache
+	{
+		TArray<uint8*, TInlineAllocator<FScratchBuffer::MaxCachedPerClass>> FreeBuffers[FScratchBuffer::NumSizeClasses];
+		int64 CachedBytes = 0;
+
+		~FThreadScratchCache()
+		{
+			for (auto& Buffers : FreeBuffers)
+			{
+				for (uint8* Buffer : Buffers)
+				{
+					FMemory::Free(Buffer);
+				}
+			}
+		}
+	};
+
+	FThreadScratchCache& GetThreadCache()
+	{
+		thread_local FThreadScratchCache Cache;
+		return Cache;
+	}
+}
+
+FScratchBuffer FScratchBuffer::Acquire(int64 Size)
+{
+	FScratchBuffer Result;
+	Result.Size = FMath::Max<int64>(Size, 0);
+	Result.SizeClass = GetSizeClass(Result.Size);
+	if (Result.SizeClass == INDEX_NONE)
+	{
+		Result.Data = static_cast<uint8*>(FMemory::Malloc(Result.Size));
+		return Result;
+	}
+
+	FThreadScratchCache& Cache = GetThreadCache();
+	auto& Buffers = Cache.FreeBuffers[Result.SizeClass];
+	if (Buffers.Num() > 0)
+	{
+		Result.Data = Buffers.Pop(EAllowShrinking::No);
+		Cache.CachedBytes -= GetClassSize(Result.SizeClass);
+	}
+	else
+	{
+		Result.Data = static_cast<uint8*>(FMemory::Malloc(GetClassSize(Result.SizeClass)));
+	}
+	return Result;
+}
+
+FScratchBuffer::~FScratchBuffer()
+{
+	Release();
+}
+
+FScratchBuffer::FScratchBuffer(FScratchBuffer&& Other) noexcept
+	: Data(Other.Data), Size(Other.Size), SizeClass(Other.SizeClass)
+{
+	Other.Data = nullptr;
+	Other.Size = 0;
+	Other.SizeClass = INDEX_NONE;
+}
+
+FScratchBuffer& FScratchBuffer::operator=(FScratchBuffer&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Release();
+		Data = Other.Data;
+		Size = Other.Size;
+		SizeClass = Other.SizeClass;
+		Other.Data = nullptr;
+		Other.Size = 0;
+		Other.SizeClass = INDEX_NONE;
+	}
+	return *this;
+}
+
+void FScratchBuffer::Release()
+{
+	if (!Data)
+	{
+		return;
+	}
+	if (SizeClass != INDEX_NONE)
+	{
+		FThreadScratchCache& Cache = GetThreadCache();
+		auto& Buffers = Cache.FreeBuffers[SizeClass];
+		const int64 ClassSize = GetClassSize(SizeClass);
+		if (Buffers.Num() < MaxCachedPerClass && Cache.CachedBytes + ClassSize <= MaxCachedBytesPerThread)
+		{
+			Buffers.Push(Data);
+			Cache.CachedBytes += ClassSize;
+			Data = nullptr;
+		}
+	}
+	if (Data)
+	{
+		FMemory::Free(Data);
+		Data = nullptr;
+	}
+	Size = 0;
+	SizeClass = INDEX_NONE;
+}
@@ -0,0 +1,98 @@
+﻿#include "WraithX/AssetDiscoverySink.h"
+
+#include "Structures/CodAssets.h"
+
+FAssetDiscoverySink::FAssetDiscoverySink(FChunkHandler InOnChunk, int32 InChunkSize, double InFlushIntervalMs)
+	: OnChunk(MoveTemp(InOnChunk)), ChunkSize(FMath::Max(InChunkSize, 1)), FlushIntervalMs(InFlushIntervalMs)
+{
+	CompletionEvent = FPlatformProcess::GetSynchEventFromPool(true);
+	LastFlushCycles = FPlatformTime::Cycles64();
+}
+
+FAssetDiscoverySink::~FAssetDiscoverySink()
+{
+	FPlatformProcess::ReturnSynchEventToPool(CompletionEvent);
+	CompletionEvent = nullptr;
+}
+
+void FAssetDiscoverySink::Push(TSharedPtr<FCoDAsset> Asset)
+{
+	if (!Asset.IsValid()) return;
+	Queue.Enqueue(MoveTemp(Asset));
+	const int32 Queued = QueuedCount.fetch_add(1) + 1;
+
+	const double SinceFlushMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - LastFlushCycles.load());
+	if (Queued >= ChunkSize || SinceFlushMs >= FlushIntervalMs)
+	{
+		// Another producer is already draining; it will pick this asset up or the next flush will.
+		if (FlushLock.TryLock())
+		{
+			FlushLocked();
+			FlushLock.Unlock();
+		}
+	}
+}
+
+void FAssetDiscoverySink::Flush()
+{
+	FScopeLock Lock(&FlushLock);
+	FlushLocked();
+}
+
+void FAssetDiscoverySink::FlushLocked()
+{
+	LastFlushCycles = FPlatformTime::Cycles64();
+
+	TArray<TSharedPtr<FCoDAsset>> Chunk;
+	Chunk.Reserve(QueuedCount.load());
+	TSharedPtr<FCoDAsset> Asset;
+	while (Queue.Dequeue(Asset))
+	{
+		Chunk.Add(MoveTemp(Asset));
+	}
+	QueuedCount.fetch_sub(Chunk.Num());
+
+	const int32 Expected = ExpectedCount.load();
+	if (!Chunk.IsEmpty())
+	{
+		const int32 Delivered = DeliveredCount.fetch_add(Chunk.Num()) + Chunk.Num();
+		if (OnChunk)
+		{
+			OnChunk(MoveTemp(Chunk), Delivered, Expected);
+		}
+	}
+
+	if (Expected != INDEX_NONE && DeliveredCount.load() >= Expected)
+	{
+		CompletionEvent->Trigger();
+	}
+}
+
+void FAssetDiscoverySink::SetExpectedCount(int32 Count)
+{
+	ExpectedCount = Count;
+	Flush();
+}
+
+bool FAssetDiscoverySink::WaitForCompletion(double StallTimeoutSeconds)
+{
+	int32 LastDelivered = DeliveredCount.load();
+	double StallDeadline = FPlatformTime::Seconds() + StallTimeoutSeconds;
+	while (!CompletionEvent->Wait(FTimespan::FromMilliseconds(FlushIntervalMs)))
+	{
+		// Assets whose names resolve late trickle in below the chunk size, so flush them on the interval.
+		Flush();
+
+		const int32 Delivered = DeliveredCount.load();
+		if (Delivered != LastDelivered)
+		{
+			LastDelivered = Delivered;
+			StallDeadline = FPlatformTime::Seconds() + StallTimeoutSeconds;
+		}
+		else if (FPlatformTime::Seconds() >= StallDeadline)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,168 @@
+﻿#include "WraithX/CachedMemoryReader.h"
+
+FCachedMemoryReader::FCachedMemoryReader(const TSharedPtr<IMemoryReader>& InInnerReader, int32 InMaxCachedPages)
+	: InnerReader(InInnerReader), PagesPerShard(FMath::Max(InMaxCachedPages / ShardCount, 1))
+{
+	for (FShard& Shard : Shards)
+	{
+		Shard.SlotPages.SetNumZeroed(PagesPerShard);
+		Shard.Prev.Init(INDEX_NONE, PagesPerShard);
+		Shard.Next.Init(INDEX_NONE, PagesPerShard);
+	}
+}
+
+void FCachedMemoryReader::Invalidate()
+{
+	// Bumped before the shards are cleared, so a fill that inserts after its shard was cleared sees the new value.
+	Generation.fetch_add(1, std::memory_order_acq_rel);
+	for (FShard& Shard : Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Shard.SlotByPage.Reset();
+		Shard.Head = INDEX_NONE;
+		Shard.Tail = INDEX_NONE;
+		Shard.UsedSlots = 0;
+		// Page storage is kept allocated for the next discovery pass.
+	}
+	Hits = 0;
+	Misses = 0;
+	Bypassed = 0;
+}
+
+void FCachedMemoryReader::SetEnabled(bool bInEnabled)
+{
+	bEnabled.store(bInEnabled, std::memory_order_release);
+	if (!bInEnabled)
+	{
+		Invalidate();
+	}
+}
+
+FCachedMemoryReader::FStats FCachedMemoryReader::GetStats() const
+{
+	FStats Stats;
+	Stats.Hits = Hits.load(std::memory_order_relaxed);
+	Stats.Misses = Misses.load(std::memory_order_relaxed);
+	Stats.Bypassed = Bypassed.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+bool FCachedMemoryReader::ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size)
+{
+	if (!IsValid() || Address == 0) return false;
+	if (!bEnabled.load(std::memory_order_acquire))
+	{
+		return ForwardReadMemory(*InnerReader, Address, OutResult, Size);
+	}
+	if (Size > MaxCachedReadSize)
+	{
+		Bypassed.fetch_add(1, std::memory_order_relaxed);
+		return ForwardReadMemory(*InnerReader, Address, OutResult, Size);
+	}
+	return ReadCached(Address, static_cast<uint8*>(OutResult), Size) ||
+		ForwardReadMemory(*InnerReader, Address, OutResult, Size);
+}
+
+bool FCachedMemoryReader::ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize)
+{
+	if (!IsValid() || Address == 0) return false;
+	if (!bEnabled.load(std::memory_order_acquire))
+	{
+		return ForwardReadArray(*InnerReader, Address, OutArrayData, Length, ElementSize);
+	}
+	const uint64 TotalSize = Length * ElementSize;
+	if (TotalSize > MaxCachedReadSize)
+	{
+		Bypassed.fetch_add(1, std::memory_order_relaxed);
+		return ForwardReadArray(*InnerReader, Address, OutArrayData, Length, ElementSize);
+	}
+	return ReadCached(Address, static_cast<uint8*>(OutArrayData), TotalSize) ||
+		ForwardReadArray(*InnerReader, Address, OutArrayData, Length, ElementSize);
+}
+
+bool FCachedMemoryReader::ReadCached(uint64 Address, uint8* OutData, uint64 Size)
+{
+	uint64 CurrentAddress = Address;
+	uint64 Remaining = Size;
+	while (Remaining > 0)
+	{
+		const uint64 PageAddress = CurrentAddress & ~(PageSize - 1);
+		const uint64 Offset = CurrentAddress - PageAddress;
+		const uint64 CopySize = FMath::Min(Remaining, PageSize - Offset);
+		// A page that cannot be filled as a whole lets the caller fall back to an exact read of the range.
+		if (!CopyPage(PageAddress, Offset, OutData, CopySize)) return false;
+
+		OutData += CopySize;
+		CurrentAddress += CopySize;
+		Remaining -= CopySize;
+	}
+	return true;
+}
+
+bool FCachedMemoryReader::CopyPage(uint64 PageAddress, uint64 Offset, uint8* OutData, uint64 Size)
+{
+	FShard& Shard = GetShard(PageAddress);
+	{
+		FScopeLock Lock(&Shard.Lock);
+		if (const int32* Slot = Shard.SlotByPage.Find(PageAddress))
+		{
+			Shard.Unlink(*Slot);
+			Shard.PushFront(*Slot);
+			FMemory::Memcpy(OutData, Shard.Data.GetData() + *Slot * PageSize + Offset, Size);
+			Hits.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	Misses.fetch_add(1, std::memory_order_relaxed);
+	const uint64 FillGeneration = Generation.load(std::memory_order_acquire);
+	uint8 Page[PageSize];
+	if (!ForwardReadMemory(*InnerReader, PageAddress, Page, PageSize)) return false;
+	FMemory::Memcpy(OutData, Page + Offset, Size);
+
+	FScopeLock Lock(&Shard.Lock);
+	// The page may predate an Invalidate that ran while it was being read; serve it to this caller only.
+	if (Generation.load(std::memory_order_acquire) != FillGeneration || !bEnabled.load(std::memory_order_acquire))
+		return true;
+	if (Shard.SlotByPage.Contains(PageAddress)) return true;
+
+	int32 Slot;
+	if (Shard.UsedSlots < PagesPerShard)
+	{
+		Slot = Shard.UsedSlots++;
+		if (Shard.Data.Num() < Shard.UsedSlots * static_cast<int32>(PageSize))
+		{
+			Shard.Data.SetNumUninitialized(Shard.UsedSlots * PageSize);
+		}
+	}
+	else
+	{
+		Slot = Shard.Tail;
+		Shard.Unlink(Slot);
+		Shard.SlotByPage.Remove(Shard.SlotPages[Slot]);
+	}
+	FMemory::Memcpy(Shard.Data.GetData() + Slot * PageSize, Page, PageSize);
+	Shard.SlotPages[Slot] = PageAddress;
+	Shard.SlotByPage.Add(PageAddress, Slot);
+	Shard.PushFront(Slot);
+	return true;
+}
+
+void FCachedMemoryReader::FShard::Unlink(int32 Slot)
+{
+	if (Prev[Slot] != INDEX_NONE) Next[Prev[Slot]] = Next[Slot];
+	else Head = Next[Slot];
+	if (Next[Slot] != INDEX_NONE) Prev[Next[Slot]] = Prev[Slot];
+	else Tail = Prev[Slot];
+	Prev[Slot] = INDEX_NONE;
+	Next[Slot] = INDEX_NONE;
+}
+
+void FCachedMemoryReader::FShard::PushFront(int32 Slot)
+{
+	Prev[Slot] = INDEX_NONE;
+	Next[Slot] = Head;
+	if (Head != INDEX_NONE) Prev[Head] = Slot;
+	Head = Slot;
+	if (Tail == INDEX_NONE) Tail = Slot;
+}
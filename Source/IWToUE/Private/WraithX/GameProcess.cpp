@@ -3,11 +3,48 @@
 #include "SeLogChannels.h"
 #include "CDN/CoDCDNDownloaderV2.h"
 #include "GameInfo/GameAssetDiscovererFactory.h"
+#include "HAL/IConsoleManager.h"
 #include "Structures/MW6GameStructures.h"
 #include "WraithX/LocateGameInfo.h"
 #include "WraithX/WindowsMemoryReader.h"
+#include "WraithX/CachedMemoryReader.h"
+#include "WraithX/RecordingMemoryReader.h"
+#include "WraithX/SnapshotMemoryReader.h"
+#include "WraithX/AssetDiscoverySink.h"
 #include "AssetImporter/AssetDiscoveryTask.h"
 
+namespace
+{
+	TAutoConsoleVariable<bool> CVarRecordMemorySnapshot(
+		TEXT("IWToUE.MemorySnapshot.Record"), false,
+		TEXT("Record every process page read, for IWToUE.MemorySnapshot.Save. Takes effect when the game process is opened."));
+
+	TAutoConsoleVariable<FString> CVarReplayMemorySnapshot(
+		TEXT("IWToUE.MemorySnapshot.Replay"), TEXT(""),
+		TEXT("Path of a memory snapshot to read from instead of the live process. Takes effect when the game process is opened."));
+
+	TWeakPtr<FRecordingMemoryReader> ActiveRecorder;
+
+	FAutoConsoleCommand SaveMemorySnapshotCommand(
+		TEXT("IWToUE.MemorySnapshot.Save"),
+		TEXT("Write the pages recorded so far to a snapshot file. Optional argument: output path."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const TSharedPtr<FRecordingMemoryReader> Recorder = ActiveRecorder.Pin();
+			if (!Recorder)
+			{
+				UE_LOG(LogITUMemoryReader, Warning,
+				       TEXT("No memory recording is active; set IWToUE.MemorySnapshot.Record 1 before opening the game process."));
+				return;
+			}
+			const FString SnapshotPath = Args.Num() > 0
+				                             ? Args[0]
+				                             : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IWToUE"),
+				                                               TEXT("MemorySnapshot.bin"));
+			Recorder->SaveSnapshot(SnapshotPath);
+		}));
+}
+
 FGameProcess::FGameProcess()
 {
 }
@@ -102,10 +139,19 @@ void FGameProcess::StartAssetDiscovery()
 		FScopeLock Lock(&LoadedAssetsLock);
 		LoadedAssets.Empty();
 	}
+	DiscoverySink = MakeShared<FAssetDiscoverySink>(
+		[WeakThis = AsWeak()](TArray<TSharedPtr<FCoDAsset>>&& Chunk, int32 Delivered, int32 Expected)
+		{
+			if (TSharedPtr<FGameProcess> This = WeakThis.Pin())
+			{
+				This->HandleAssetChunkDiscovered(MoveTemp(Chunk), Delivered, Expected);
+			}
+		});
+	if (CachedMemoryReader)
 	{
-		FScopeLock Lock(&ProgressLock);
-		CurrentDiscoveryProgressCount = 0.0f;
-		TotalDiscoveredAssets = 0.0f;
+		// Discovery treats process memory as a snapshot; imports later read it live.
+		CachedMemoryReader->Invalidate();
+		CachedMemoryReader->SetEnabled(true);
 	}
 	bIsDiscovering = true;
 	UE_LOG(LogITUMemoryReader, Log, TEXT("Starting asynchronous asset discovery..."));
@@ -166,8 +212,27 @@ bool FGameProcess::FindTargetProcess()
 
 bool FGameProcess::OpenProcessHandleAndReader()
 {
-	if (TargetProcessId == 0) return false;
-	MemoryReader = MakeShared<FWindowsMemoryReader>(TargetProcessId);
+	TSharedPtr<IMemoryReader> ProcessReader;
+	const FString ReplayPath = CVarReplayMemorySnapshot.GetValueOnAnyThread();
+	if (!ReplayPath.IsEmpty())
+	{
+		UE_LOG(LogITUMemoryReader, Log, TEXT("Reading process memory from snapshot %s."), *ReplayPath);
+		ProcessReader = MakeShared<FSnapshotMemoryReader>(ReplayPath);
+	}
+	else
+	{
+		if (TargetProcessId == 0) return false;
+		ProcessReader = MakeShared<FWindowsMemoryReader>(TargetProcessId);
+		if (CVarRecordMemorySnapshot.GetValueOnAnyThread())
+		{
+			// Below the page cache, so only pages actually fetched from the process are recorded.
+			TSharedPtr<FRecordingMemoryReader> Recorder = MakeShared<FRecordingMemoryReader>(ProcessReader);
+			ActiveRecorder = Recorder;
+			ProcessReader = Recorder;
+		}
+	}
+	CachedMemoryReader = MakeShared<FCachedMemoryReader>(ProcessReader);
+	MemoryReader = CachedMemoryReader;
 	return MemoryReader->IsValid();
 }
 
@@ -216,39 +281,34 @@ bool FGameProcess::CreateAndInitializeDiscoverer()
 	return true;
 }
 
-void FGameProcess::HandleAssetDiscovered(TSharedPtr<FCoDAsset> DiscoveredAsset)
+void FGameProcess::HandleAssetChunkDiscovered(TArray<TSharedPtr<FCoDAsset>>&& DiscoveredAssets, int32 Delivered,
+                                              int32 Expected)
 {
-	if (DiscoveredAsset.IsValid())
 	{
 		FScopeLock Lock(&LoadedAssetsLock);
-		LoadedAssets.Add(MoveTemp(DiscoveredAsset));
-	}
-	if (TotalDiscoveredAssets != 0)
-	{
-		FScopeLock Lock(&ProgressLock);
-		CurrentDiscoveryProgressCount = LoadedAssets.Num() / TotalDiscoveredAssets;
+		LoadedAssets.Append(MoveTemp(DiscoveredAssets));
 	}
 
-	if (CurrentDiscoveryProgressCount > 0)
+	const float Progress = Expected > 0 ? FMath::Min(static_cast<float>(Delivered) / Expected, 1.0f) : 0.0f;
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = AsWeak(), Progress]()
 	{
-		AsyncTask(ENamedThreads::GameThread, [this]()
+		if (TSharedPtr<FGameProcess> This = WeakThis.Pin())
 		{
-			OnAssetLoadingProgress.Broadcast(CurrentDiscoveryProgressCount);
-		});
-	}
-
-	if (LoadedAssets.Num() == TotalDiscoveredAssets)
-	{
-		AsyncTask(ENamedThreads::GameThread, [this]()
-		{
-			HandleDiscoveryComplete();
-		});
-	}
+			This->OnAssetLoadingProgress.Broadcast(Progress);
+		}
+	});
 }
 
 void FGameProcess::HandleDiscoveryComplete()
 {
 	UE_LOG(LogTemp, Log, TEXT("Asset Discovery Complete. Total Assets Found: %d"), LoadedAssets.Num());
+	if (CachedMemoryReader)
+	{
+		const FCachedMemoryReader::FStats Stats = CachedMemoryReader->GetStats();
+		UE_LOG(LogITUMemoryReader, Log, TEXT("Memory page cache: %llu hits, %llu page fills, %llu uncached reads."),
+		       Stats.Hits, Stats.Misses, Stats.Bypassed);
+		CachedMemoryReader->SetEnabled(false);
+	}
 	bIsDiscovering = false;
 
 	OnAssetLoadingProgress.Broadcast(1.0f);
@@ -0,0 +1,102 @@
+﻿#include "WraithX/RecordingMemoryReader.h"
+
+#include "SeLogChannels.h"
+#include "HAL/FileManager.h"
+#include "WraithX/SnapshotMemoryReader.h"
+
+FRecordingMemoryReader::FRecordingMemoryReader(const TSharedPtr<IMemoryReader>& InInnerReader, uint32 InPageSize)
+	: InnerReader(InInnerReader), PageSize(FMath::Max(InPageSize, 1u))
+{
+}
+
+bool FRecordingMemoryReader::ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size)
+{
+	if (!IsValid()) return false;
+	if (!ForwardReadMemory(*InnerReader, Address, OutResult, Size)) return false;
+	RecordRange(Address, Size);
+	return true;
+}
+
+bool FRecordingMemoryReader::ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize)
+{
+	if (!IsValid()) return false;
+	if (!ForwardReadArray(*InnerReader, Address, OutArrayData, Length, ElementSize)) return false;
+	RecordRange(Address, Length * ElementSize);
+	return true;
+}
+
+void FRecordingMemoryReader::RecordRange(uint64 Address, uint64 Size)
+{
+	if (Address == 0 || Size == 0) return;
+
+	const uint64 FirstPage = Address - Address % PageSize;
+	const uint64 LastPage = (Address + Size - 1) - (Address + Size - 1) % PageSize;
+
+	TArray<uint64> MissingPages;
+	{
+		FReadScopeLock ReadLock(PagesLock);
+		for (uint64 PageAddress = FirstPage; PageAddress <= LastPage; PageAddress += PageSize)
+		{
+			if (!RecordedPages.Contains(PageAddress) && !UnreadablePages.Contains(PageAddress))
+			{
+				MissingPages.Add(PageAddress);
+			}
+		}
+	}
+	if (MissingPages.IsEmpty()) return;
+
+	// Whole pages are captured so that later reads of neighbouring data replay from the same page.
+	for (const uint64 PageAddress : MissingPages)
+	{
+		TArray<uint8> Page;
+		Page.SetNumUninitialized(PageSize);
+		const bool bRead = ForwardReadMemory(*InnerReader, PageAddress, Page.GetData(), PageSize);
+
+		FWriteScopeLock WriteLock(PagesLock);
+		if (bRead)
+		{
+			RecordedPages.FindOrAdd(PageAddress, MoveTemp(Page));
+		}
+		else
+		{
+			UnreadablePages.Add(PageAddress);
+		}
+	}
+}
+
+int32 FRecordingMemoryReader::GetRecordedPageCount() const
+{
+	FReadScopeLock ReadLock(PagesLock);
+	return RecordedPages.Num();
+}
+
+bool FRecordingMemoryReader::SaveSnapshot(const FString& SnapshotPath) const
+{
+	FReadScopeLock ReadLock(PagesLock);
+
+	TArray<uint64> PageAddresses;
+	RecordedPages.GetKeys(PageAddresses);
+	PageAddresses.Sort();
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*SnapshotPath));
+	if (!Writer)
+	{
+		UE_LOG(LogITUMemoryReader, Error, TEXT("Failed to create memory snapshot: %s"), *SnapshotPath);
+		return false;
+	}
+
+	FMemorySnapshotHeader Header;
+	Header.PageSize = PageSize;
+	Header.PageCount = PageAddresses.Num();
+	Writer->Serialize(&Header, sizeof(Header));
+	Writer->Serialize(PageAddresses.GetData(), PageAddresses.Num() * sizeof(uint64));
+	for (const uint64 PageAddress : PageAddresses)
+	{
+		Writer->Serialize(const_cast<uint8*>(RecordedPages[PageAddress].GetData()), PageSize);
+	}
+
+	const bool bSuccess = Writer->Close();
+	UE_LOG(LogITUMemoryReader, Log, TEXT("Saved memory snapshot %s (%d pages, %d unreadable)."), *SnapshotPath,
+	       PageAddresses.Num(), UnreadablePages.Num());
+	return bSuccess;
+}
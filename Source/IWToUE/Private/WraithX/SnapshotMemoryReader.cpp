@@ -0,0 +1,118 @@
+﻿#include "WraithX/SnapshotMemoryReader.h"
+
+#include "SeLogChannels.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+
+FSnapshotMemoryReader::FSnapshotMemoryReader(const FString& SnapshotPath)
+{
+	MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*SnapshotPath);
+	if (!MappedFile)
+	{
+		UE_LOG(LogITUMemoryReader, Error, TEXT("Failed to map memory snapshot: %s"), *SnapshotPath);
+		return;
+	}
+	MappedRegion = MappedFile->MapRegion();
+	if (!MappedRegion || MappedRegion->GetMappedSize() < sizeof(FMemorySnapshotHeader))
+	{
+		UE_LOG(LogITUMemoryReader, Error, TEXT("Memory snapshot is truncated: %s"), *SnapshotPath);
+		return;
+	}
+
+	const uint8* Base = MappedRegion->GetMappedPtr();
+	FMemorySnapshotHeader Header;
+	FMemory::Memcpy(&Header, Base, sizeof(Header));
+	if (Header.Magic != FMemorySnapshotHeader::SnapshotMagic ||
+		Header.Version != FMemorySnapshotHeader::SnapshotVersion || Header.PageSize == 0)
+	{
+		UE_LOG(LogITUMemoryReader, Error, TEXT("Invalid memory snapshot header: %s"), *SnapshotPath);
+		return;
+	}
+
+	// Bounding PageCount by the mapped payload keeps the table and page data inside the mapping without
+	// computing a size that could overflow.
+	const uint64 PayloadSize = MappedRegion->GetMappedSize() - sizeof(FMemorySnapshotHeader);
+	if (Header.PageCount > PayloadSize / (sizeof(uint64) + Header.PageSize))
+	{
+		UE_LOG(LogITUMemoryReader, Error, TEXT("Memory snapshot is truncated: %s"), *SnapshotPath);
+		return;
+	}
+
+	// CopyRange binary-searches the address table and steps to adjacent entries, so it must be sorted, unique and
+	// page aligned. Checked once here rather than on every read.
+	const uint64* Addresses = reinterpret_cast<const uint64*>(Base + sizeof(FMemorySnapshotHeader));
+	for (uint64 Index = 0; Index < Header.PageCount; ++Index)
+	{
+		if (Addresses[Index] % Header.PageSize != 0 || (Index > 0 && Addresses[Index - 1] >= Addresses[Index]))
+		{
+			UE_LOG(LogITUMemoryReader, Error, TEXT("Memory snapshot has an unsorted or unaligned page table: %s"),
+			       *SnapshotPath);
+			return;
+		}
+	}
+
+	PageCount = Header.PageCount;
+	PageSize = Header.PageSize;
+	PageData = Base + sizeof(FMemorySnapshotHeader) + PageCount * sizeof(uint64);
+	PageAddresses = Addresses;
+
+	UE_LOG(LogITUMemoryReader, Log, TEXT("Loaded memory snapshot %s (%llu pages of %llu bytes)."), *SnapshotPath,
+	       PageCount, PageSize);
+}
+
+FSnapshotMemoryReader::~FSnapshotMemoryReader()
+{
+	delete MappedRegion;
+	delete MappedFile;
+}
+
+bool FSnapshotMemoryReader::ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size)
+{
+	if (!IsValid() || Address == 0) return false;
+	return CopyRange(Address, static_cast<uint8*>(OutResult), Size);
+}
+
+bool FSnapshotMemoryReader::ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize)
+{
+	if (!IsValid() || Address == 0) return false;
+	return CopyRange(Address, static_cast<uint8*>(OutArrayData), Length * ElementSize);
+}
+
+bool FSnapshotMemoryReader::CopyRange(uint64 Address, uint8* OutData, uint64 Size) const
+{
+	const TArrayView64<const uint64> Pages(PageAddresses, static_cast<int64>(PageCount));
+	int64 PageIndex = INDEX_NONE;
+	uint64 CurrentAddress = Address;
+	uint64 Remaining = Size;
+
+	while (Remaining > 0)
+	{
+		const uint64 PageAddress = CurrentAddress - CurrentAddress % PageSize;
+		// Consecutive pages of a region are usually adjacent in the table, so avoid a search when possible.
+		if (PageIndex == INDEX_NONE || PageIndex + 1 >= Pages.Num() || Pages[PageIndex + 1] != PageAddress)
+		{
+			const int64 Found = Algo::BinarySearch(Pages, PageAddress);
+			if (Found == INDEX_NONE)
+			{
+				UE_LOG(LogITUMemoryReader, Verbose, TEXT("Address 0x%llX is not part of the memory snapshot."),
+				       CurrentAddress);
+				return false;
+			}
+			PageIndex = Found;
+		}
+		else
+		{
+			++PageIndex;
+		}
+
+		const uint64 PageOffset = CurrentAddress - PageAddress;
+		const uint64 CopySize = FMath::Min(Remaining, PageSize - PageOffset);
+		FMemory::Memcpy(OutData, PageData + PageIndex * PageSize + PageOffset, CopySize);
+
+		OutData += CopySize;
+		CurrentAddress += CopySize;
+		Remaining -= CopySize;
+	}
+	return true;
+}
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "Interface/IGameAssetDiscoverer.h"
 #include "WraithX/GameProcess.h"
+#include "WraithX/AssetDiscoverySink.h"
+#include "Async/ParallelFor.h"
 
 
 class IWTOUE_API FAssetDiscoveryTask : public FNonAbandonableTask
@@ -21,23 +23,45 @@ public:
 		UE_LOG(LogTemp, Log, TEXT("AssetDiscoveryTask: Starting discovery."));
 
 		TArray<FAssetPoolDefinition> Pools = OwnerPtr->AssetDiscoverer->GetAssetPools();
-
+		TSharedPtr<FAssetDiscoverySink> Sink = OwnerPtr->DiscoverySink;
+		// Assets are published through the sink in chunks, including those whose names resolve asynchronously later.
 		FAssetDiscoveredDelegate DiscoveredDelegate = FAssetDiscoveredDelegate::CreateSP(
-			OwnerPtr.Get(), &FGameProcess::HandleAssetDiscovered);
-		// FDiscoveryProgressDelegate ProgressDelegate = FDiscoveryProgressDelegate::CreateSP(
-		// OwnerPtr.Get(), &FGameProcess::HandleDiscoveryProgress);
+			Sink.ToSharedRef(), &FAssetDiscoverySink::Push);
 
-		int32 AssetCnt = 0;
-		for (const FAssetPoolDefinition& Pool : Pools)
+		TArray<int32> PoolCounts;
+		PoolCounts.SetNumZeroed(Pools.Num());
+
+		// Pools are independent linked lists, so each one is walked by its own worker.
+		ParallelFor(Pools.Num(), [&](int32 PoolIdx)
 		{
-			if (!OwnerPtr.IsValid()) break;
+			const FAssetPoolDefinition& Pool = Pools[PoolIdx];
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			PoolCounts[PoolIdx] = OwnerPtr->AssetDiscoverer->DiscoverAssetsInPool(Pool, DiscoveredDelegate);
+			UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryTask: Pool %s walked %d assets in %.2f ms."), *Pool.PoolName,
+			       PoolCounts[PoolIdx], FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+		});
 
-			UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryTask: Discovering pool %s"), *Pool.PoolName);
-			AssetCnt += OwnerPtr->AssetDiscoverer->DiscoverAssetsInPool(Pool, DiscoveredDelegate);
-			UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryTask: Finished pool %s"), *Pool.PoolName);
+		int32 AssetCnt = 0;
+		for (const int32 PoolCount : PoolCounts)
+		{
+			AssetCnt += PoolCount;
 		}
-		OwnerPtr->SetTotalAssetCnt(AssetCnt);
-		DiscoveredDelegate.ExecuteIfBound(nullptr);
+		Sink->SetExpectedCount(AssetCnt);
+		if (!Sink->WaitForCompletion(CompletionTimeoutSeconds))
+		{
+			UE_LOG(LogTemp, Warning,
+			       TEXT("AssetDiscoveryTask: Only %d of %d assets arrived, none for %.0f s, completing anyway."),
+			       Sink->GetDeliveredCount(), AssetCnt, CompletionTimeoutSeconds);
+		}
+		Sink->Flush();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakOwner = Owner]()
+		{
+			if (TSharedPtr<FGameProcess> CompletedOwner = WeakOwner.Pin())
+			{
+				CompletedOwner->HandleDiscoveryComplete();
+			}
+		});
 
 		UE_LOG(LogTemp, Log, TEXT("AssetDiscoveryTask: Discovery work complete."));
 	}
@@ -48,5 +72,8 @@ public:
 	}
 
 private:
+	// Safety net only: discoverers count just the assets they scheduled, so delivery normally completes the barrier.
+	static constexpr double CompletionTimeoutSeconds = 60.0;
+
 	TWeakPtr<FGameProcess> Owner;
 };
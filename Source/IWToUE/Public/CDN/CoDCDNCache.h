@@ -11,20 +11,110 @@ struct FCoDCDNCacheEntry
 	uint64 Offset;
 	// The size of the object 
 	uint64 Size;
+	// UTC ticks of the last Add or Extract, used for LRU eviction.
+	int64 LastAccess;
+	// XXH3 of the stored bytes, or 0 for entries written before checksums existed.
+	uint64 ContentHash;
+	// Set once the entry has been read back and matched ContentHash this session.
+	int8 bVerified;
 };
 
+/**
+ * @brief On-disk cache of downloaded CDN objects.
+ * Objects are appended to the data file. Each Add also appends one fixed-size record to .cdn_journal, and the
+ * full index in .cdn_info is only rewritten at checkpoints. Load replays the journal on top of the last
+ * checkpoint, stopping at the first torn record and skipping records written against another data file.
+ * Once the live objects exceed the byte budget the least recently used ones are evicted. When enough of the
+ * data file is dead, a background pass copies the live objects into a new data file, and a checkpoint swaps it in.
+ * Every entry carries an XXH3 of its bytes. The first Extract of an entry in a session verifies it, and
+ * entries that fail verification are evicted.
+ */
 class FCoDCDNCache
 {
 public:
-	bool Load(const FString& Name);
+	~FCoDCDNCache();
+
+	bool Load(const FString& Name, int64 InMaxCacheBytes = DefaultMaxCacheBytes);
+	/** @brief Writes a checkpoint of the index and empties the journal. */
 	bool Save();
 	bool Add(const uint64 Hash, const TArray<uint8>& Buffer);
 	bool Extract(uint64 Hash, int32 ExpectedSize, TArray<uint8>& OutBuffer);
 
+	/** @brief Changes the byte budget for live objects, evicting immediately if needed. 0 disables the budget. */
+	void SetMaxCacheSize(int64 InMaxCacheBytes);
+
+	static constexpr int64 DefaultMaxCacheBytes = 8ll * 1024 * 1024 * 1024;
+	// Journal records between automatic checkpoints.
+	static constexpr int32 CheckpointInterval = 4096;
+	// Compaction starts once at least this many dead bytes make up half of the data file.
+	static constexpr int64 MinCompactionBytes = 64ll * 1024 * 1024;
+
 private:
+	struct FJournalRecord
+	{
+		uint64 Hash;
+		uint64 Offset;
+		uint64 Size;
+		uint64 ContentHash;
+		// DataGeneration the offset refers to. After a compaction the old journal may outlive the checkpoint that
+		// switched data files, so replay drops records of any other generation.
+		uint32 Generation;
+		uint32 Flags;
+		uint32 Checksum;
+		// Keeps the record free of uninitialized padding.
+		uint32 Reserved;
+	};
+
+	enum EJournalFlags : uint32
+	{
+		JournalRemoved = 1 << 0,
+	};
+
+	static uint32 ComputeRecordChecksum(const FJournalRecord& Record);
+
+	// Callers hold CacheLock for writing.
+	bool LoadCheckpoint();
+	int32 ReplayJournal();
+	bool WriteCheckpoint();
+	/** @brief Writes .cdn_info for the current Entries as if they lived in the given data file. */
+	bool SaveCheckpointFile(const FString& InDataFilePath, uint32 InDataGeneration, int64 InDataFileSize) const;
+	bool OpenWriters(bool bTruncateJournal);
+	bool AppendJournal(uint64 Hash, uint64 Offset, uint64 Size, uint64 ContentHash, uint32 Flags);
+	void EvictLeastRecentlyUsed();
+	void StartCompactionIfNeeded();
+	void DeleteStaleDataFiles() const;
+
+	/** @brief Drops an entry whose bytes failed verification, unless it was replaced or moved in the meantime. */
+	void EvictCorruptEntry(uint64 Hash, uint64 Offset);
+
+	void RunCompaction(TArray<FCoDCDNCacheEntry> LiveEntries, FString SourcePath, FString TargetPath);
+
 	FRWLock CacheLock;
+	FString CacheName;
+	FString CacheDir;
 	FString InfoFilePath;
 	FString DataFilePath;
+	FString JournalFilePath;
 	TMap<uint64, FCoDCDNCacheEntry> Entries;
 	bool bIsLoaded = false;
+
+	// Both stay open for the lifetime of the cache.
+	TUniquePtr<IFileHandle> DataHandle;
+	TUniquePtr<IFileHandle> JournalHandle;
+	int64 DataFileSize = 0;
+	int32 JournalRecordCount = 0;
+
+	int64 MaxCacheBytes = DefaultMaxCacheBytes;
+	int64 LiveBytes = 0;
+	uint32 DataGeneration = 0;
+	bool bIsCompacting = false;
+	TFuture<void> CompactionTask;
+
+	uint64 AddCount = 0;
+	uint64 AddedBytes = 0;
+	uint64 AddCycles = 0;
+
+	std::atomic<uint64> ExtractCount{0};
+	std::atomic<uint64> ExtractCycles{0};
+	std::atomic<uint64> VerifyCycles{0};
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "CoDCDNCache.h"
+#include "CoDCDNNegativeCache.h"
 #include "UObject/Object.h"
 
 class FCoDCDNDownloader
@@ -15,13 +16,17 @@ public:
 	 * @return 传出字节数
 	 */
 	virtual int32 ExtractCDNObject(TArray<uint8>& Buffer, uint64 CacheID, int32 BufferSize) = 0;
+	/** @brief Records a definitive miss; it is persisted and backs off exponentially. */
 	virtual void AddFiled(const uint64 CacheID);
+	/** @brief Records a transport failure; it is retried after a short delay and never persisted. */
+	virtual void AddTransientFailure(const uint64 CacheID);
+	/** @brief True while CacheID is backing off after earlier failures; check before requesting it. */
 	virtual bool HasFailed(const uint64 CacheID);
+	virtual void ClearFailed(const uint64 CacheID);
 
 protected:
 	FCoDCDNCache Cache;
-	TMap<uint64, FDateTime> FailedAttempts;
-	FRWLock CDNLock;
+	FCoDCDNNegativeCache FailedObjects;
 	bool bIsCDNAvailable = false;
 	bool bIsInitialized = false;
 };
@@ -4,6 +4,7 @@
 #include "CoDCDNDownloader.h"
 
 class IWebClient;
+class FCoDCDNFetchScheduler;
 
 struct FCoDCDNDownloaderV2Entry
 {
@@ -32,5 +33,8 @@ private:
 	const FString CoDV2CDNURL = "http://cod-assets.cdn.blizzard.com/pc/iw9_2";
 
 	TSharedPtr<IWebClient> Client;
+	TSharedPtr<FCoDCDNFetchScheduler, ESPMode::ThreadSafe> FetchScheduler;
+	// Downloads allowed to run at once; further misses queue in the scheduler.
+	static constexpr int32 MaxConcurrentFetches = 8;
 	// TUniquePtr<ICasCDNFileSystem> FileSystem;
 };
@@ -0,0 +1,55 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "IWebClient.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+
+/**
+ * @brief Runs CDN downloads through the asynchronous IWebClient API with bounded concurrency.
+ * Requests for a key that is already downloading share that download's future instead of starting another.
+ */
+class FCoDCDNFetchScheduler : public TSharedFromThis<FCoDCDNFetchScheduler, ESPMode::ThreadSafe>
+{
+public:
+	using FFetchResult = TSharedPtr<FDownloadMemoryResult>;
+
+	FCoDCDNFetchScheduler(TSharedPtr<IWebClient> InClient, int32 InMaxConcurrentFetches);
+	~FCoDCDNFetchScheduler();
+
+	/**
+	 * @brief Returns the in-flight download for Key, or starts one for Url. Once MaxConcurrentFetches downloads
+	 * are running, new ones are queued in request order.
+	 * @return Future resolving to the downloaded data, or nullptr if the request failed.
+	 */
+	TSharedFuture<FFetchResult> Fetch(uint64 Key, const FString& Url);
+	/**
+	 * @brief Blocks until the future resolves. Completions are delivered on the game thread, so when called there
+	 * this pumps the HTTP manager itself.
+	 */
+	static FFetchResult Wait(const TSharedFuture<FFetchResult>& Future);
+
+private:
+	struct FFetch
+	{
+		uint64 Key;
+		FString Url;
+		TPromise<FFetchResult> Promise;
+	};
+
+	void Start(const TSharedPtr<FFetch>& Fetch);
+	void OnFetchComplete(const TSharedPtr<FFetch>& Fetch, FFetchResult Result);
+
+	TSharedPtr<IWebClient> Client;
+	const int32 MaxConcurrentFetches;
+
+	// Guards everything below; never held while a download is started or a promise is fulfilled.
+	FCriticalSection FetchLock;
+	TMap<uint64, TSharedFuture<FFetchResult>> InFlight;
+	TQueue<TSharedPtr<FFetch>> Pending;
+	int32 ActiveFetches = 0;
+
+	uint64 StartedFetches = 0;
+	uint64 JoinedFetches = 0;
+	int32 PeakActiveFetches = 0;
+};
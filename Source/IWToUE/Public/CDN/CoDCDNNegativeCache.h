@@ -0,0 +1,65 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Persisted record of CDN objects that could not be downloaded.
+ * Each failure pushes the next retry out exponentially with random jitter, so a missing object costs one
+ * request per backoff window instead of a full timeout on every lookup. Entries expire after the TTL.
+ * Transient failures (timeouts, connection errors, server errors) only hold an object back for a short, fixed
+ * delay and are never saved, so an outage does not mark objects missing for days.
+ */
+class FCoDCDNNegativeCache
+{
+public:
+	struct FPolicy
+	{
+		// Delay before the first retry; doubles with each further failure.
+		FTimespan InitialBackoff = FTimespan::FromMinutes(1.0);
+		FTimespan MaxBackoff = FTimespan::FromDays(1.0);
+		// Entries are dropped this long after their first failure, whatever their backoff.
+		FTimespan TimeToLive = FTimespan::FromDays(7.0);
+		// Each delay is scaled by a random factor in [1 - JitterFraction, 1 + JitterFraction].
+		float JitterFraction = 0.2f;
+		// Delay after a transient failure; kept in memory only.
+		FTimespan TransientBackoff = FTimespan::FromSeconds(10.0);
+	};
+
+	~FCoDCDNNegativeCache();
+
+	bool Load(const FString& Name, const FPolicy& InPolicy = FPolicy());
+	bool Save();
+
+	/** @brief Returns true while Key is inside its backoff window, i.e. no request should be made for it. */
+	bool ShouldSkip(uint64 Key);
+	/** @brief Records a definitive miss, e.g. a 404, which is persisted with exponential backoff. */
+	void RecordFailure(uint64 Key);
+	void RecordTransientFailure(uint64 Key);
+	void RecordSuccess(uint64 Key);
+
+	// Failures recorded between automatic saves.
+	static constexpr int32 SaveInterval = 64;
+
+private:
+	struct FEntry
+	{
+		int64 FirstFailureTicks;
+		int64 RetryAfterTicks;
+		uint32 FailureCount;
+	};
+
+	FTimespan ComputeBackoff(uint64 Key, uint32 FailureCount) const;
+	// Callers hold Lock for writing.
+	bool SaveLocked();
+
+	FRWLock Lock;
+	FString FilePath;
+	FPolicy Policy;
+	TMap<uint64, FEntry> Entries;
+	// Retry-after ticks of objects whose last request failed transiently.
+	TMap<uint64, int64> TransientEntries;
+	int32 UnsavedChanges = 0;
+	bool bIsLoaded = false;
+
+	std::atomic<uint64> SkippedRequests{0};
+};
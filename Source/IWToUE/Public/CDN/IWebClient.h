@@ -5,6 +5,10 @@
 struct FDownloadMemoryResult
 {
 	TArray<uint8> DataBuffer;
+	// HTTP status of the response the buffer came from.
+	int32 ResponseCode = 0;
+
+	bool IsSuccessful() const { return ResponseCode >= 200 && ResponseCode < 300; }
 
 	FString AsString() const
 	{
@@ -15,6 +15,6 @@ class FXSubCacheV2
 #pragma pack(pop)
 
 public:
-	static bool DecompressPackageObject(uint64 CacheID, TArray<uint8>& Buffer, int32 DecompressedSize,
+	static bool DecompressPackageObject(uint64 CacheID, const TArray<uint8>& Buffer, int32 DecompressedSize,
 	                                    TArray<uint8>& OutBuffer);
 };
@@ -0,0 +1,69 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * @brief Memory-mapped, read-only hash to name dictionary built from WNI files.
+ * Layout: header, EntryCount sorted 60-bit hashes, EntryCount + 1 offsets into the name blob, then the blob.
+ * Lookups binary-search the mapped hash array, so opening costs no parsing and almost no resident memory.
+ * Each build is written under a new generation number (AssetNames.<N>.dict for AssetNames.dict) because a mapped
+ * file cannot be replaced on Windows while readers may still hold the previous mapping.
+ */
+class FAssetNameDictionary
+{
+public:
+	~FAssetNameDictionary();
+
+	static TUniquePtr<FAssetNameDictionary> Open(const FString& FilePath);
+
+	/** @return Path of the newest dictionary generation for BasePath, or an empty string if none exists. */
+	static FString FindLatestFile(const FString& BasePath);
+
+	/**
+	 * @brief Parses every WNI file and writes the next dictionary generation; later files win on duplicate hashes.
+	 * Older generations are deleted when nothing maps them any more.
+	 * @return false if no dictionary could be written.
+	 */
+	static bool Build(const TArray<FString>& WniFiles, const FString& BasePath);
+
+	TOptional<FString> Find(uint64 Hash) const;
+	bool Contains(uint64 Hash) const { return FindIndex(Hash) != INDEX_NONE; }
+	int64 Num() const { return EntryCount; }
+
+	/**
+	 * @brief Decompresses a WNI file and visits its entries without allocating per name.
+	 * @return false if the file could not be read or is corrupted.
+	 */
+	static bool ParseWniFile(const FString& FilePath,
+	                         TFunctionRef<void(uint64 Hash, const ANSICHAR* Name, int32 Length)> Visitor);
+
+private:
+	struct FHeader
+	{
+		static constexpr uint32 DictionaryMagic = 0x444E5749; // 'IWND'
+		static constexpr uint32 DictionaryVersion = 1;
+
+		uint32 Magic = DictionaryMagic;
+		uint32 Version = DictionaryVersion;
+		uint64 EntryCount = 0;
+		uint64 BlobSize = 0;
+	};
+
+	FAssetNameDictionary() = default;
+
+	int64 FindIndex(uint64 Hash) const;
+
+	/** @brief Lists existing generations of BasePath as (generation, path), oldest first. */
+	static TArray<TPair<int32, FString>> FindGenerationFiles(const FString& BasePath);
+
+	IMappedFileHandle* MappedFile = nullptr;
+	IMappedFileRegion* MappedRegion = nullptr;
+
+	const uint64* Hashes = nullptr;
+	const uint32* Offsets = nullptr;
+	const ANSICHAR* Blob = nullptr;
+	int64 EntryCount = 0;
+};
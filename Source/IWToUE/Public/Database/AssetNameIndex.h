@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Read-only open-addressing table of asset names keyed by 60-bit hash.
+ * Names are stored back to back as UTF-8 in a single arena. The index is immutable once built,
+ * so any number of threads may call Find() without synchronization.
+ */
+class FAssetNameIndex
+{
+public:
+	explicit FAssetNameIndex(int32 ExpectedCount);
+
+	// Only valid while building, before the index is shared with readers. Grows past ExpectedCount if needed.
+	void Add(uint64 Hash, const FString& Value);
+
+	TOptional<FString> Find(uint64 Hash) const;
+	bool Contains(uint64 Hash) const { return FindSlot(Hash) != INDEX_NONE; }
+
+	int32 Num() const { return Count; }
+	SIZE_T GetAllocatedSize() const;
+
+	// Keys are masked to 60 bits, so an all-ones key can never collide with a real hash.
+	static constexpr uint64 EmptyKey = ~0ull;
+	static constexpr uint64 HashMask = 0xFFFFFFFFFFFFFFF;
+
+private:
+	int32 FindSlot(uint64 Hash) const;
+	// Doubles the slot count and reinserts every key; names stay where they are in the arena.
+	void Grow();
+	uint32 GetHomeSlot(uint64 Hash) const
+	{
+		return static_cast<uint32>((Hash * 0x9E3779B97F4A7C15ull) >> 32) & SlotMask;
+	}
+
+	TArray<uint64> Keys;
+	TArray<uint32> NameOffsets;
+	TArray<uint32> NameLengths;
+	TArray<UTF8CHAR> Arena;
+	uint32 SlotMask = 0;
+	int32 Count = 0;
+};
@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 
 struct FXSubPackageCacheObject;
+class FAssetNameIndex;
+class FAssetNameDictionary;
+class FXSubInfoIndex;
 class IAsyncTaskQueue;
 class IGameRepository;
 class IFileMetaRepository;
@@ -30,6 +33,14 @@ public:
 	// AssetName Operations
 	FString GetPrintfAssetName(uint64 Hash, const FString& NamePrefix = TEXT(""));
 	TOptional<FString> GetAssetNameSync(uint64 Hash);
+	/**
+	 * @brief Resolves many hashes at once, answering each distinct hash only once.
+	 * @param OutNames Replaced with one name per input hash, in input order; any previous contents are discarded.
+	 *                 Unknown hashes are formatted like GetPrintfAssetName does with NamePrefix.
+	 * @return Number of hashes that had a known name.
+	 */
+	int32 ResolveNamesBatch(TArrayView<const uint64> Hashes, TArray<FString>& OutNames,
+	                        const FString& NamePrefix = TEXT(""));
 	void GetAssetNameAsync(uint64 Hash, TFunction<void(TOptional<FString>)> Callback);
 	void UpdateAssetNameAsync(uint64 Hash, const FString& Value, TFunction<void(bool)> CompletionCallback = nullptr);
 	void UpdateAssetNameBatchAsync(const TMap<uint64, FString>& Items,
@@ -40,6 +51,9 @@ public:
 	TOptional<FXSubPackageCacheObject> GetXSubInfoSync(uint64 DecryptionKey);
 	void GetXSubInfoAsync(uint64 DecryptionKey, TFunction<void(TOptional<FXSubPackageCacheObject>)> Callback);
 
+	// Times lookups against the published in-memory indices on the DB queue and logs the results.
+	void RunIndexBenchmarksAsync();
+
 	FOnDatabaseInitializedDelegate OnDatabaseInitialized;
 	FOnFileTrackingCompleteDelegate OnFileTrackingComplete;
 
@@ -50,6 +64,29 @@ private:
 	FString GetDefaultDatabasePath() const;
 	void HandleFileTrackingComplete();
 
+	// Publishes the newest WNI name dictionary the tracker wrote, if it is not mapped yet. Runs on the tracker
+	// thread from HandleFileTrackingComplete, independently of the index rebuild.
+	void MapLatestAssetNameDictionary();
+	// Loads the whole AssetNameCache table into a new index and publishes it. Runs on the DB queue thread.
+	void RebuildAssetNameIndex();
+	// Returns false while no index has been published; callers then query SQLite and the dictionary. Otherwise
+	// OutName holds the authoritative answer.
+	bool TryGetIndexedAssetName(uint64 Hash, TOptional<FString>& OutName) const;
+	// Index, then dictionary lookup without overrides. Hash must already be masked.
+	static TOptional<FString> FindIndexedAssetName(const FAssetNameIndex& Index, const FAssetNameDictionary* Dictionary,
+	                                              uint64 Hash);
+	// AssetNameCache rows are user edits and win over the WNI dictionary; an empty value is a deleted WNI name.
+	static TOptional<FString> ResolveStoredAssetName(TOptional<FString> StoredName,
+	                                                 const FAssetNameDictionary* Dictionary, uint64 Hash);
+	void SetAssetNameOverride(uint64 Hash, TOptional<FString> Value);
+	// Drops overrides the freshly published index already agrees with. Runs on the DB queue thread.
+	void FoldAssetNameOverrides(const FAssetNameIndex& Index);
+	void BenchmarkAssetNameIndex();
+	// Compares index lookups against the SQLite query the index replaces.
+	void BenchmarkXSubInfoIndex();
+	// Loads the whole SubFileInfo table into a sorted index and publishes it. Runs on the DB queue thread.
+	void RebuildXSubInfoIndex();
+
 	// 将任务推入延迟执行队列
 	void EnqueueActualDbTask(TFunction<void()> Task);
 
@@ -64,6 +101,25 @@ private:
 	uint64 CurrentGameHash = 0;
 	FString CurrentGamePath;
 
+	// Published index read without locks. Replaced indices are kept alive until Shutdown because readers hold
+	// no reference; only the DB queue thread and Shutdown touch AssetNameIndices.
+	std::atomic<const FAssetNameIndex*> AssetNameIndex{nullptr};
+	TArray<TUniquePtr<FAssetNameIndex>> AssetNameIndices;
+	// Published and retired the same way, but only HandleFileTrackingComplete and Shutdown touch the array.
+	std::atomic<const FAssetNameDictionary*> AssetNameDictionary{nullptr};
+	TArray<TUniquePtr<FAssetNameDictionary>> AssetNameDictionaries;
+	// Base path handed to FAssetNameDictionary; the mapped file is the generation last published.
+	FString NameDictionaryPath;
+	FString MappedDictionaryPath;
+	// Published and retired the same way as AssetNameIndex.
+	std::atomic<const FXSubInfoIndex*> XSubInfoIndex{nullptr};
+	TArray<TUniquePtr<FXSubInfoIndex>> XSubInfoIndices;
+
+	// Edits made after the index was built. Unset values mark deleted names.
+	mutable FRWLock NameOverridesLock;
+	TMap<uint64, TOptional<FString>> NameOverrides;
+	std::atomic<bool> bHasNameOverrides{false};
+
 	FCriticalSection DeferredTasksLock;
 	TQueue<TFunction<void()>> DeferredDbTasks;
 
@@ -17,7 +17,8 @@ public:
 		const TSharedPtr<IFileMetaRepository>& InFileMetaRepo,
 		const TSharedPtr<IGameRepository>& InGameRepo,
 		const TSharedPtr<IAssetNameRepository>& InAssetNameRepo,
-		const TSharedPtr<IXSubInfoRepository>& InXSubInfoRepo
+		const TSharedPtr<IXSubInfoRepository>& InXSubInfoRepo,
+		const FString& InNameDictionaryPath
 	);
 	virtual ~FCoDFileTracker() override;
 
@@ -38,18 +39,45 @@ public:
 	}
 
 private:
+	struct FTrackedFile;
+
 	void ProcessFiles();
+	/**
+	 * @brief Compares the given files against their FileMeta rows without writing them. Stats and content hashes
+	 * are computed on the worker pool; a file whose timestamp is unchanged is not hashed. Database access stays on
+	 * the calling thread.
+	 */
+	void RefreshFileMetas(TArray<FTrackedFile>& Files);
+	/**
+	 * @brief Writes the FileMeta row refreshed by RefreshFileMetas. Call only once everything derived from the file
+	 * is stored, so an interrupted or failed pass is picked up again next time.
+	 */
+	bool CommitFileMeta(FTrackedFile& File);
+	/**
+	 * @brief Gives a new file its FileId through a placeholder row that never matches a real file, so the file is
+	 * parsed again if the pass ends before CommitFileMeta.
+	 */
+	bool ReserveFileId(FTrackedFile& File);
+	/**
+	 * @brief Parses XSub files on the worker pool while the calling thread diffs each against its stored rows, in
+	 * file order. Only added, changed and removed keys are written, in a single transaction, and the files' FileMeta
+	 * rows are committed once that transaction succeeded. Files that fail to parse keep their stored rows.
+	 * @return Number of files diffed.
+	 */
+	int32 ParseAndStoreXSubFiles(const TArray<FTrackedFile*>& Files);
+	/** @brief Runs Body for [0, Num) on at most MaxWorkerCount pool threads; stops early when tracking is stopped. */
+	void RunOnWorkers(int32 Num, TFunctionRef<void(int32 Index)> Body) const;
+	TArray<FTrackedFile> GatherTrackedFiles(const TArray<FString>& FilePaths, uint64 GameHash,
+	                                        const FString& BaseDir) const;
 	TArray<FString> FindWniFilesToTrack() const;
 	TArray<FString> FindXSubFilesToTrack() const;
 	FString GetRelativePath(const FString& FullPath, const FString& BaseDir) const;
-	uint64 ComputeFileContentHash(const FString& FilePath, int64 ComputeSize = 1024 * 1024) const;
+	// Same sampled XXH3 fingerprint FXSub uses; covers the file end, where XSub tables live.
+	uint64 ComputeFileContentHash(const FString& FilePath) const;
 	int64 GetFileLastModifiedTime(const FString& FilePath) const;
 
-	void ParseWniFile(const FString& FilePath, TMap<uint64, FString>& Items);
-	void ParseXSubFile(const FString& FilePath, TMap<uint64, FXSubPackageCacheObject>& Items, int64 FileId);
-
-	bool CheckIfFileNeedsUpdate(uint64 GameHash, const FString& RelativePath, uint64 NewContentHash,
-	                            int64 NewLastModifiedTime, int64& OutFileId);
+	/** @return false if the file could not be mapped or is invalid; Items is then incomplete and must not be stored. */
+	bool ParseXSubFile(const FString& FilePath, TMap<uint64, FXSubPackageCacheObject>& Items, int64 FileId);
 
 	TSharedPtr<IFileMetaRepository> FileMetaRepo;
 	TSharedPtr<IGameRepository> GameRepo;
@@ -62,4 +90,8 @@ private:
 	uint64 CurrentGameHash = 0;
 	FString CurrentGamePath;
 	FString PluginBasePath;
+	FString NameDictionaryPath;
+
+	// Hashing and parsing are I/O bound, so more workers than this mostly add seek contention.
+	static constexpr int32 MaxWorkerCount = 8;
 };
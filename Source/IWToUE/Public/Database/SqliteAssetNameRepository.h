@@ -17,7 +17,11 @@ public:
 	virtual bool InsertOrUpdate(uint64 Hash, const FString& Value) override;
 	virtual bool BatchInsertOrUpdate(const TMap<uint64, FString>& Items) override;
 	virtual TOptional<FString> QueryValue(uint64 Hash) override;
+	virtual bool QueryValues(TConstArrayView<uint64> Hashes, TMap<uint64, FString>& OutValues) override;
 	virtual bool DeleteByHash(uint64 Hash) override;
+	virtual int32 QueryCount() override;
+	virtual bool QueryAll(TFunctionRef<void(uint64 Hash, const FString& Value)> Visitor) override;
+	virtual bool DeleteLegacyWniNames(TFunctionRef<bool(uint64 Hash)> IsWniName) override;
 
 private:
 	TSharedRef<IDatabaseConnection> Connection;
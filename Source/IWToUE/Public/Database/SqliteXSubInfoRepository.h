@@ -12,6 +12,13 @@ public:
 
 	virtual bool BatchInsertOrUpdate(const TMap<uint64, FXSubPackageCacheObject>& Items) override;
 	virtual TOptional<FXSubPackageCacheObject> QueryValue(uint64 DecryptionKey) override;
+	virtual int32 QueryCount() override;
+	virtual bool QueryAll(
+		TFunctionRef<void(uint64 DecryptionKey, const FXSubPackageCacheObject& Value)> Visitor) override;
+	virtual bool QueryFilePaths(TFunctionRef<void(int64 FileId, const FString& AbsolutePath)> Visitor) override;
+	virtual bool QueryByFile(int64 FileId, TMap<uint64, FXSubPackageCacheObject>& OutItems) override;
+	virtual bool ApplyChanges(const TMap<uint64, FXSubPackageCacheObject>& Upserts,
+	                          TConstArrayView<uint64> Deletes) override;
 
 private:
 	TSharedRef<IDatabaseConnection> Connection;
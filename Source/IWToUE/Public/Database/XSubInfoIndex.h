@@ -0,0 +1,51 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+struct FXSubPackageCacheObject;
+
+/**
+ * @brief Read-only index of every SubFileInfo row, sorted by decryption key.
+ * Entries are fixed-width and reference their source file through a small interned path table,
+ * so a lookup is a binary search over a flat key array. Immutable once Finalize() has run.
+ */
+class FXSubInfoIndex
+{
+public:
+	explicit FXSubInfoIndex(int32 ExpectedCount);
+
+	// Builder API. Only valid before the index is shared with readers.
+	void AddFile(int64 FileId, const FString& Path);
+	void Add(uint64 DecryptionKey, int64 FileId, uint64 Offset, uint64 CompressedSize, uint64 UncompressedSize);
+	void Finalize();
+
+	TOptional<FXSubPackageCacheObject> Find(uint64 DecryptionKey) const;
+	bool Contains(uint64 DecryptionKey) const { return FindIndex(DecryptionKey) != INDEX_NONE; }
+
+	int32 Num() const { return Keys.Num(); }
+	int32 NumFiles() const { return Files.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FEntry
+	{
+		uint64 Offset;
+		uint64 CompressedSize;
+		uint64 UncompressedSize;
+		int32 FileIndex;
+	};
+
+	struct FFile
+	{
+		int64 FileId;
+		FString Path;
+	};
+
+	int32 FindIndex(uint64 DecryptionKey) const;
+
+	// Keys and entries are parallel arrays so the search only touches the key array.
+	TArray<uint64> Keys;
+	TArray<FEntry> Entries;
+	TArray<FFile> Files;
+	TMap<int64, int32> FileIndexById;
+};
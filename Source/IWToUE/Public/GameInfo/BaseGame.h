@@ -232,7 +232,9 @@ protected:
 		});
 
 		const double DurationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
-		UE_LOG(LogTemp, Verbose, TEXT("Processed %d surfaces in %.2fms"), GfxWorldSurfaces.Count, DurationMs);
+		UE_LOG(LogTemp, Verbose, TEXT("Processed %d surfaces in %.2fms (%.0f surfaces/s, %d workers)"),
+		       GfxWorldSurfaces.Count, DurationMs, DurationMs > 0.0 ? GfxWorldSurfaces.Count * 1000.0 / DurationMs : 0.0,
+		       FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
 	}
 
 	static void UnpackCoDQTangent(const uint32 Packed, FVector3f& Tangent, FVector3f& Normal)
@@ -30,12 +30,13 @@ private:
 	bool ReadAssetPoolHeader(int32 PoolIdentifier, FXAssetPool64& OutPoolHeader);
 	bool ReadAssetNode(uint64 AssetNodePtr, FXAsset64& OutAssetNode);
 
-	void DiscoverModelAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
-	void DiscoverImageAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
-	void DiscoverAnimAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
-	void DiscoverMaterialAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
-	void DiscoverSoundAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
-	void DiscoverMapAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
+	// false if the node yields no asset, so it is left out of the expected count
+	bool DiscoverModelAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
+	bool DiscoverImageAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
+	bool DiscoverAnimAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
+	bool DiscoverMaterialAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
+	bool DiscoverSoundAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
+	bool DiscoverMapAssets(FXAsset64 AssetNode, FAssetDiscoveredDelegate OnAssetDiscovered);
 	
 	TSharedPtr<LocateGameInfo::FParasyteBaseState> ParasyteState;
 	
@@ -4,7 +4,11 @@
 
 struct FMW6XAnimBufferState;
 struct FMW6XModel;
+struct FMW6GfxSurface;
+struct FMW6GfxUgbSurfData;
+struct FMW6GfxWorldTransientZone;
 struct FCastRoot;
+struct FCastMeshInfo;
 
 class FModernWarfare6AssetHandler : public IGameAssetHandler
 {
@@ -36,6 +40,25 @@ public:
 	virtual void LoadXModel(FWraithXModel& InModel, FWraithXModelLod& ModelLod, FCastModelInfo& OutModel) override;
 
 protected:
+	// Local copies of one map surface's vertex and index streams, reused across surfaces.
+	struct FMapSurfaceBuffers
+	{
+		TArray<uint64> Positions;
+		TArray<uint32> TangentFrames;
+		TArray<FVector2f> TexCoords;
+		TArray<uint8> Tables;
+		TArray<uint8> PackedIndices;
+		TArray<uint16> Indices;
+		TArray<uint32> FaceOffsets;
+		// Number of process reads issued for the last surface.
+		uint32 ReadCount = 0;
+	};
+
+	// Reads a surface's streams with a few bulk reads and decodes them from local memory.
+	bool ReadMapSurface(const FMW6GfxSurface& GfxSurface, const FMW6GfxUgbSurfData& UgbSurfData,
+	                    const FMW6GfxWorldTransientZone& Zone, FMapSurfaceBuffers& Buffers,
+	                    FCastMeshInfo& OutMeshInfo);
+
 	void LoadXAnim(const FWraithXAnim& InAnim, FCastAnimationInfo& OutAnim);
 
 	void MW6XAnimCalculateBufferIndex(FMW6XAnimBufferState& AnimState, const int32 TableSize,
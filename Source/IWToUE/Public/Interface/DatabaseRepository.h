@@ -9,7 +9,12 @@ public:
 	virtual bool InsertOrUpdate(uint64 Hash, const FString& Value) = 0;
 	virtual bool BatchInsertOrUpdate(const TMap<uint64, FString>& Items) = 0;
 	virtual TOptional<FString> QueryValue(uint64 Hash) = 0;
+	virtual bool QueryValues(TConstArrayView<uint64> Hashes, TMap<uint64, FString>& OutValues) = 0;
 	virtual bool DeleteByHash(uint64 Hash) = 0;
+	virtual int32 QueryCount() = 0;
+	virtual bool QueryAll(TFunctionRef<void(uint64 Hash, const FString& Value)> Visitor) = 0;
+	// One-time migration: deletes the rows older versions copied from WNI files. Later calls do nothing.
+	virtual bool DeleteLegacyWniNames(TFunctionRef<bool(uint64 Hash)> IsWniName) = 0;
 };
 
 class IXSubInfoRepository
@@ -18,6 +23,14 @@ public:
 	virtual ~IXSubInfoRepository() = default;
 	virtual bool BatchInsertOrUpdate(const TMap<uint64, FXSubPackageCacheObject>& Items) = 0;
 	virtual TOptional<FXSubPackageCacheObject> QueryValue(uint64 DecryptionKey) = 0;
+	virtual int32 QueryCount() = 0;
+	// Visits every row without joining file paths; Value.Path is left empty. Use QueryFilePaths for those.
+	virtual bool QueryAll(TFunctionRef<void(uint64 DecryptionKey, const FXSubPackageCacheObject& Value)> Visitor) = 0;
+	virtual bool QueryFilePaths(TFunctionRef<void(int64 FileId, const FString& AbsolutePath)> Visitor) = 0;
+	// Rows currently stored for one source file; Value.Path is left empty.
+	virtual bool QueryByFile(int64 FileId, TMap<uint64, FXSubPackageCacheObject>& OutItems) = 0;
+	// Deletes, then upserts, all within one transaction.
+	virtual bool ApplyChanges(const TMap<uint64, FXSubPackageCacheObject>& Upserts, TConstArrayView<uint64> Deletes) = 0;
 };
 
 class IFileMetaRepository
@@ -47,6 +47,10 @@ public:
 
 	virtual TArray<FAssetPoolDefinition> GetAssetPools() const = 0;
 
+	/**
+	 * @brief Walks one pool, delivering assets through OnAssetDiscovered, possibly after this returns.
+	 * @return Number of assets that will be delivered; the discovery barrier waits for exactly this many.
+	 */
 	virtual int32 DiscoverAssetsInPool(const FAssetPoolDefinition& PoolDefinition,
 	                                   FAssetDiscoveredDelegate OnAssetDiscovered) = 0;
 
@@ -1,12 +1,5 @@
 ﻿#pragma once
 
-#include "Windows/AllowWindowsPlatformTypes.h"
-#include <windows.h>
-#include <tlhelp32.h>
-#include <Psapi.h>
-#include <string>
-#include "Windows/HideWindowsPlatformTypes.h"
-
 #include "CoreMinimal.h"
 
 class IMemoryReader
@@ -14,7 +7,6 @@ class IMemoryReader
 public:
 	virtual ~IMemoryReader() = default;
 	virtual bool IsValid() const = 0;
-	virtual HANDLE GetProcessHandle() const = 0;
 
 	template <typename T>
 	bool ReadMemory(uint64 Address, T& OutResult, bool bIsLocal = false);
@@ -22,11 +14,38 @@ public:
 	template <typename T>
 	bool ReadArray(uint64 Address, TArray<T>& OutArray, uint64 Length);
 
-	virtual bool ReadString(uint64 Address, FString& OutString, int MaxLength = 20480) = 0;
+	virtual bool ReadString(uint64 Address, FString& OutString, int MaxLength = 20480);
+
+	/**
+	 * @brief Reads many null-terminated strings, sharing page reads between strings that live close together.
+	 * @param OutStrings Receives one entry per address; entries that could not be read are left empty.
+	 * @return Number of strings read successfully.
+	 */
+	int32 ReadStrings(TConstArrayView<uint64> Addresses, TArray<FString>& OutStrings, int MaxLength = 20480);
 
 protected:
 	virtual bool ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size) = 0;
 	virtual bool ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize) = 0;
+
+	bool ReadNullTerminatedString(uint64 Address, TArray<ANSICHAR>& OutBuffer, int32 MaxLength);
+
+	// Guards bIsLocal reads of our own address space; platform specific, so kept out of this header.
+	static bool IsLocalRangeReadable(const void* Address, SIZE_T Size);
+
+	static constexpr uint64 StringPageSize = 4096;
+	static constexpr uint64 FirstStringChunkSize = 256;
+
+	// Decorating readers wrap another reader and forward raw reads to it.
+	static bool ForwardReadMemory(IMemoryReader& Reader, uint64 Address, void* OutResult, size_t Size)
+	{
+		return Reader.ReadMemoryImpl(Address, OutResult, Size);
+	}
+
+	static bool ForwardReadArray(IMemoryReader& Reader, uint64 Address, void* OutArrayData, uint64 Length,
+	                             size_t ElementSize)
+	{
+		return Reader.ReadArrayImpl(Address, OutArrayData, Length, ElementSize);
+	}
 };
 
 #include "IMemoryReader.inl"
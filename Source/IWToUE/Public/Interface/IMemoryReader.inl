@@ -5,7 +5,7 @@ bool IMemoryReader::ReadMemory(uint64 Address, T& OutResult, bool bIsLocal)
 {
 	if (bIsLocal)
 	{
-		if (IsBadReadPtr(reinterpret_cast<const void*>(Address), sizeof(T))) return false;
+		if (!IsLocalRangeReadable(reinterpret_cast<const void*>(Address), sizeof(T))) return false;
 		OutResult = *reinterpret_cast<T*>(Address);
 		return true;
 	}
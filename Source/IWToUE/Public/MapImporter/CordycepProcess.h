@@ -117,9 +117,6 @@ T FCordycepProcess::ReadMemory(uint64 Address, bool bIsLocal)
 	}
 	else
 	{
-		static FCriticalSection ProcessHandleCriticalSection;
-		FScopeLock Lock(&ProcessHandleCriticalSection);
-
 		if (ProcessHandle)
 		{
 			SIZE_T BytesRead;
@@ -1,7 +1,5 @@
 ﻿#pragma once
 
-class FLargeMemoryReader;
-
 struct FXSubBlock
 {
 	uint8 CompressionType;
@@ -62,8 +60,6 @@ public:
 	FXSub(uint64 GameID, const FString& GamePath);
 
 	void LoadFiles();
-	void ReadXSub(FLargeMemoryReader& Reader, const FString& FilePath, int32 FileIndex,
-	              TMap<uint64, FXSubPackageCacheObject>& LocalCache);
 	TArray<uint8> ExtractXSubPackage(uint64 Key, uint32 Size);
 	bool ExistsKey(uint64 CacheID);
 	void RemoveInvalidEntries(const FString& RemovedFilePath);
@@ -78,6 +74,9 @@ public:
 
 	FString ComputeOptimizedHash(const FString& FilePath);
 
+	/** @brief Hashes the file size plus a 64 KB prefix and a few 4 KB samples spread over the rest of the file. */
+	static uint64 ComputeFingerprint(const FString& FilePath, int64 FileSize);
+
 private:
 	FRWLock CacheLock;
 
@@ -0,0 +1,38 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+struct FXSubParsedEntry
+{
+	uint64 Key;
+	uint64 Offset;
+	uint64 CompressedSize;
+	uint64 UncompressedSize;
+};
+
+/**
+ * @brief Shared parser for the header and hash table of .xsub files.
+ * The hash table is decoded straight from the mapped file in one pass; each package's block table is
+ * only touched to sum its decompressed size.
+ */
+class FXSubParser
+{
+public:
+	static constexpr uint32 XSubMagic = 0x4950414b;
+	static constexpr uint64 PackageType = 3;
+	// On-disk size of an FXSubHashEntryV2; the in-memory struct is padded to 24 bytes.
+	static constexpr int64 HashEntrySize = 20;
+
+	/**
+	 * @brief Maps FilePath and parses it.
+	 * @return Number of entries passed to Sink, or INDEX_NONE if the file could not be mapped or is invalid.
+	 */
+	static int64 ParseFile(const FString& FilePath, TFunctionRef<void(const FXSubParsedEntry& Entry)> Sink);
+	/** @brief Parses an in-memory .xsub image. FilePath is only used for diagnostics. */
+	static int64 Parse(const uint8* Data, int64 DataSize, const FString& FilePath,
+	                   TFunctionRef<void(const FXSubParsedEntry& Entry)> Sink);
+
+private:
+	static uint64 GetUncompressedSize(const uint8* Data, int64 DataSize, uint64 Key, uint64 Offset,
+	                                  uint64 CompressedSize);
+};
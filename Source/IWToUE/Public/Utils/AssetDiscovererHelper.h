@@ -3,8 +3,9 @@
 #include "Interface/IMemoryReader.h"
 #include "WraithX/GameProcess.h"
 
+// Returns false if the header cannot be read; otherwise the asset is delivered once its name resolves.
 template <typename TGameAssetStruct, typename TCoDAssetType>
-void ProcessGenericAssetNode(IMemoryReader* Reader, const FXAsset64& AssetNode,
+bool ProcessGenericAssetNode(IMemoryReader* Reader, const FXAsset64& AssetNode,
                              EWraithAssetType WraithType,
                              const TCHAR* DefaultPrefix,
                              TFunction<void(const TGameAssetStruct& AssetHeader,
@@ -15,7 +16,7 @@ void ProcessGenericAssetNode(IMemoryReader* Reader, const FXAsset64& AssetNode,
 	if (!Reader->ReadMemory<TGameAssetStruct>(AssetNode.Header, AssetHeader))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Failed to read asset header struct at 0x%llX"), AssetNode.Header);
-		return;
+		return false;
 	}
 
 	uint64 AssetHash = AssetHeader.Hash & 0xFFFFFFFFFFFFFFF;
@@ -43,6 +44,7 @@ void ProcessGenericAssetNode(IMemoryReader* Reader, const FXAsset64& AssetNode,
 
 			OnAssetDiscovered.ExecuteIfBound(StaticCastSharedPtr<FCoDAsset>(LoadedAsset));
 		});
+	return true;
 }
 
 FORCEINLINE FString ProcessAssetName(const FString& Name)
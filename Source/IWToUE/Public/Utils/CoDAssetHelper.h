@@ -109,6 +109,21 @@ namespace FCoDMeshHelper
 	bool UnpackFaceIndices(TSharedPtr<IMemoryReader>& MemoryReader, TArray<uint16>& InFacesArr, uint64 Tables,
 	                       uint64 TableCount, uint64 PackedIndices,
 	                       uint64 Indices, uint64 FaceIndex, const bool IsLocal = false);
+
+	/**
+	 * @brief Computes how many bytes of packed index data the given (locally buffered) tables reference.
+	 * @param Tables Packed index tables, 40 bytes per table.
+	 * @param TableCount Number of tables in the buffer.
+	 * @return Size in bytes that must be read from the packed index stream.
+	 */
+	uint64 GetPackedIndicesSize(const uint8* Tables, uint64 TableCount);
+	/**
+	 * @brief Decodes the index-buffer offsets of one triangle from locally buffered tables and packed indices.
+	 * @param OutFaceOffsets Receives the three offsets into the surface's index buffer.
+	 * @return false if FaceIndex is not covered by any table.
+	 */
+	bool UnpackFaceOffsetsLocal(const uint8* Tables, uint64 TableCount, const uint8* PackedIndices, uint64 FaceIndex,
+	                            uint32 OutFaceOffsets[3]);
 	void UnpackCoDQTangent(const uint32 Packed, FVector3f& Tangent, FVector3f& Normal);
 };
 
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * @brief Process-wide, bounded pool of read handles keyed by file path.
+ * Reads are positional, so one handle is shared by every thread reading the same file.
+ */
+class FFileHandlePool
+{
+public:
+	struct FStats
+	{
+		uint64 Opens = 0;
+		uint64 Closes = 0;
+		uint64 Reads = 0;
+		double OpenSeconds = 0.0;
+	};
+
+	static FFileHandlePool& Get();
+
+	/**
+	 * @brief Reads Size bytes at Offset without touching any shared file position.
+	 * @return false if the file cannot be opened or the read comes up short.
+	 */
+	bool ReadAt(const FString& Path, int64 Offset, void* Dest, int64 Size);
+	/** @brief Returns the size of the file behind a pooled handle, or -1 if it cannot be opened. */
+	int64 GetFileSize(const FString& Path);
+	/** @brief Closes the pooled handle for Path, e.g. before the file is rewritten or deleted. */
+	void Release(const FString& Path);
+	/** @brief Closes every pooled handle. */
+	void ReleaseAll();
+
+	FStats GetStats() const;
+	void LogStats() const;
+
+	static constexpr int32 MaxOpenHandles = 32;
+
+private:
+	FFileHandlePool() = default;
+
+	struct FEntry
+	{
+		TSharedPtr<IFileHandle> Handle;
+		uint64 LastUse = 0;
+	};
+
+	TSharedPtr<IFileHandle> Acquire(const FString& Path);
+	void EvictLeastRecentlyUsed();
+
+	mutable FCriticalSection PoolLock;
+	TMap<FString, FEntry> Handles;
+	uint64 UseCounter = 0;
+
+	std::atomic<uint64> OpenCount{0};
+	std::atomic<uint64> CloseCount{0};
+	std::atomic<uint64> ReadCount{0};
+	std::atomic<uint64> OpenCycles{0};
+};
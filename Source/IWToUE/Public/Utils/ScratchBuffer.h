@@ -0,0 +1,42 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Move-only scratch allocation taken from a per-thread cache of size-classed buffers.
+ * Buffers go back to the releasing thread's cache instead of the allocator, so hot decode paths
+ * stop paying for large allocations and fresh page faults on every call.
+ */
+class FScratchBuffer
+{
+public:
+	/** Smallest size class; each following class doubles it, up to 4 MB. Larger requests are not cached. */
+	static constexpr int64 MinClassSize = 64 * 1024;
+	static constexpr int32 NumSizeClasses = 7;
+	/** Released buffers kept per size class and thread; further releases are freed. */
+	static constexpr int32 MaxCachedPerClass = 2;
+	/** Upper bound on the bytes a thread keeps cached across all classes; further releases are freed. */
+	static constexpr int64 MaxCachedBytesPerThread = 8 * 1024 * 1024;
+
+	/** @brief Returns a buffer of at least Size bytes. The contents are uninitialized. */
+	static FScratchBuffer Acquire(int64 Size);
+
+	FScratchBuffer() = default;
+	~FScratchBuffer();
+	FScratchBuffer(FScratchBuffer&& Other) noexcept;
+	FScratchBuffer& operator=(FScratchBuffer&& Other) noexcept;
+	FScratchBuffer(const FScratchBuffer&) = delete;
+	FScratchBuffer& operator=(const FScratchBuffer&) = delete;
+
+	uint8* GetData() const { return Data; }
+	int64 Num() const { return Size; }
+	TArrayView<uint8> GetView() const { return TArrayView<uint8>(Data, static_cast<int32>(Size)); }
+
+private:
+	void Release();
+
+	uint8* Data = nullptr;
+	int64 Size = 0;
+	/** INDEX_NONE for requests above the largest class, which are not cached. */
+	int32 SizeClass = INDEX_NONE;
+};
@@ -0,0 +1,54 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+
+struct FCoDAsset;
+
+/**
+ * @brief Collects discovered assets from any thread and publishes them in chunks.
+ * A chunk is published once ChunkSize assets are queued or FlushIntervalMs has passed since the last one.
+ * Completion is explicit: once the expected count is known and that many assets were delivered, waiters are released.
+ */
+class FAssetDiscoverySink : public TSharedFromThis<FAssetDiscoverySink>
+{
+public:
+	// Receives each published chunk together with the delivered and expected totals (Expected is INDEX_NONE while unknown).
+	using FChunkHandler = TFunction<void(TArray<TSharedPtr<FCoDAsset>>&& Chunk, int32 Delivered, int32 Expected)>;
+
+	explicit FAssetDiscoverySink(FChunkHandler InOnChunk, int32 InChunkSize = 1024, double InFlushIntervalMs = 100.0);
+	~FAssetDiscoverySink();
+
+	// Thread-safe, never blocks on another producer.
+	void Push(TSharedPtr<FCoDAsset> Asset);
+	// Publishes everything queued so far as one chunk.
+	void Flush();
+
+	// Sets the number of assets the walk will produce; completes immediately if they were already delivered.
+	void SetExpectedCount(int32 Count);
+	/**
+	 * @brief Blocks until the expected number of assets has been delivered, flushing stragglers meanwhile.
+	 * @param StallTimeoutSeconds Gives up once no asset has arrived for this long.
+	 * @return false if delivery stalled before completing.
+	 */
+	bool WaitForCompletion(double StallTimeoutSeconds);
+
+	int32 GetDeliveredCount() const { return DeliveredCount.load(); }
+
+private:
+	void FlushLocked();
+
+	FChunkHandler OnChunk;
+	int32 ChunkSize;
+	double FlushIntervalMs;
+
+	TQueue<TSharedPtr<FCoDAsset>, EQueueMode::Mpsc> Queue;
+	std::atomic<int32> QueuedCount{0};
+	std::atomic<int32> DeliveredCount{0};
+	std::atomic<int32> ExpectedCount{INDEX_NONE};
+	std::atomic<uint64> LastFlushCycles{0};
+
+	// Only one thread drains the queue at a time so chunks are published in order.
+	FCriticalSection FlushLock;
+	FEvent* CompletionEvent = nullptr;
+};
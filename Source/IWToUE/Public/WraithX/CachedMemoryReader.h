@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Interface/IMemoryReader.h"
+
+/**
+ * @brief Read-through page cache in front of another reader.
+ * Small reads are served from a sharded LRU of fixed-size pages; large reads go straight to the wrapped reader.
+ * Cached pages are not kept coherent with the target process, so the cache starts disabled and is only switched on
+ * for passes that treat process memory as a snapshot, such as asset discovery. While disabled every read is forwarded.
+ */
+class FCachedMemoryReader final : public IMemoryReader
+{
+public:
+	struct FStats
+	{
+		uint64 Hits = 0;
+		uint64 Misses = 0;
+		uint64 Bypassed = 0;
+	};
+
+	explicit FCachedMemoryReader(const TSharedPtr<IMemoryReader>& InInnerReader, int32 InMaxCachedPages = 16384);
+
+	virtual bool IsValid() const override { return InnerReader.IsValid() && InnerReader->IsValid(); }
+
+	// Drops every cached page and resets the counters. Fills already in flight are not inserted afterwards.
+	void Invalidate();
+	// Disabling also drops every cached page, so nothing cached now is served once the cache is enabled again.
+	void SetEnabled(bool bInEnabled);
+
+	FStats GetStats() const;
+
+	static constexpr uint64 PageSize = 4096;
+
+protected:
+	virtual bool ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size) override;
+	virtual bool ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize) override;
+
+private:
+	static constexpr int32 ShardCount = 16;
+	// Reads larger than this are one syscall anyway and would only evict useful pages.
+	static constexpr uint64 MaxCachedReadSize = PageSize * 4;
+
+	struct FShard
+	{
+		FCriticalSection Lock;
+		TMap<uint64, int32> SlotByPage;
+		TArray<uint64> SlotPages;
+		// Intrusive LRU list over slots; Head is the most recently used.
+		TArray<int32> Prev;
+		TArray<int32> Next;
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+		int32 UsedSlots = 0;
+		TArray<uint8> Data;
+
+		void Unlink(int32 Slot);
+		void PushFront(int32 Slot);
+	};
+
+	bool ReadCached(uint64 Address, uint8* OutData, uint64 Size);
+	bool CopyPage(uint64 PageAddress, uint64 Offset, uint8* OutData, uint64 Size);
+
+	FShard& GetShard(uint64 PageAddress) { return Shards[(PageAddress / PageSize) % ShardCount]; }
+
+	TSharedPtr<IMemoryReader> InnerReader;
+	int32 PagesPerShard;
+	FShard Shards[ShardCount];
+
+	std::atomic<uint64> Hits{0};
+	std::atomic<uint64> Misses{0};
+	std::atomic<uint64> Bypassed{0};
+
+	std::atomic<bool> bEnabled{false};
+	// Bumped by Invalidate; a fill started under an older generation must not insert its page.
+	std::atomic<uint64> Generation{0};
+};
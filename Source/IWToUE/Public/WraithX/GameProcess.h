@@ -16,6 +16,8 @@
 class FXSub;
 class IGameAssetDiscoverer;
 class IMemoryReader;
+class FCachedMemoryReader;
+class FAssetDiscoverySink;
 class FCoDCDNDownloader;
 
 struct FCoDAsset;
@@ -73,7 +75,6 @@ public:
 	// --- Asset Loading ---
 	void StartAssetDiscovery();
 	bool IsDiscoveringAssets() const { return bIsDiscovering; }
-	void SetTotalAssetCnt(int32 InCnt) { TotalDiscoveredAssets = InCnt; }
 
 	FORCEINLINE TArray<TSharedPtr<FCoDAsset>>& GetLoadedAssets() { return LoadedAssets; }
 
@@ -107,7 +108,7 @@ private:
 	bool CreateAndInitializeDiscoverer();
 
 	// --- Callbacks ---
-	void HandleAssetDiscovered(TSharedPtr<FCoDAsset> DiscoveredAsset);
+	void HandleAssetChunkDiscovered(TArray<TSharedPtr<FCoDAsset>>&& DiscoveredAssets, int32 Delivered, int32 Expected);
 	void HandleDiscoveryComplete();
 
 	HANDLE ProcessHandle{nullptr};
@@ -121,7 +122,6 @@ private:
 
 	TArray<TSharedPtr<FCoDAsset>> LoadedAssets;
 	FCriticalSection LoadedAssetsLock;
-	FCriticalSection ProgressLock;
 
 	float CurrentLoadingProgress = 0.f;
 
@@ -143,12 +143,12 @@ private:
 	TSharedPtr<IGameAssetDiscoverer> AssetDiscoverer;
 
 	TSharedPtr<IMemoryReader> MemoryReader;
-
-	float TotalDiscoveredAssets = 0.0f;
-	float CurrentDiscoveryProgressCount = 0.0f;
+	// Same object as MemoryReader; kept typed so the page cache can be invalidated and profiled.
+	TSharedPtr<FCachedMemoryReader> CachedMemoryReader;
 
 	// --- Async Task Management ---
 	FAsyncTask<class FAssetDiscoveryTask>* DiscoveryTask = nullptr;
+	TSharedPtr<FAssetDiscoverySink> DiscoverySink;
 
 	std::atomic<bool> bIsInitialized = false;
 	std::atomic<bool> bIsDiscovering = false;
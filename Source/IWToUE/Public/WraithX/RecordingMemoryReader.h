@@ -0,0 +1,39 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Interface/IMemoryReader.h"
+
+/**
+ * @brief Decorates another reader and captures every page it reads.
+ * The captured pages can be written to a sparse snapshot file and replayed with FSnapshotMemoryReader.
+ */
+class FRecordingMemoryReader final : public IMemoryReader
+{
+public:
+	explicit FRecordingMemoryReader(const TSharedPtr<IMemoryReader>& InInnerReader, uint32 InPageSize = 4096);
+
+	virtual bool IsValid() const override { return InnerReader.IsValid() && InnerReader->IsValid(); }
+
+	/**
+	 * @brief Writes all captured pages to a snapshot file.
+	 * @return false if the file could not be written.
+	 */
+	bool SaveSnapshot(const FString& SnapshotPath) const;
+
+	int32 GetRecordedPageCount() const;
+
+protected:
+	virtual bool ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size) override;
+	virtual bool ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize) override;
+
+private:
+	void RecordRange(uint64 Address, uint64 Size);
+
+	TSharedPtr<IMemoryReader> InnerReader;
+	uint32 PageSize;
+
+	mutable FRWLock PagesLock;
+	TMap<uint64, TArray<uint8>> RecordedPages;
+	// Pages the inner reader could not read; they are left out of the snapshot so replayed reads fail too.
+	TSet<uint64> UnreadablePages;
+};
@@ -0,0 +1,51 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Interface/IMemoryReader.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * @brief On-disk layout of a memory snapshot written by FRecordingMemoryReader.
+ * Header, then PageCount sorted page addresses, then PageCount * PageSize bytes of page data.
+ */
+struct FMemorySnapshotHeader
+{
+	static constexpr uint32 SnapshotMagic = 0x534D5749; // 'IWMS'
+	static constexpr uint32 SnapshotVersion = 1;
+
+	uint32 Magic = SnapshotMagic;
+	uint32 Version = SnapshotVersion;
+	uint32 PageSize = 0;
+	uint32 Reserved = 0;
+	uint64 PageCount = 0;
+};
+
+/**
+ * @brief Serves reads from a memory snapshot file instead of a live process.
+ * The file is memory mapped; reads touching pages that were never recorded fail like unreadable process memory.
+ */
+class FSnapshotMemoryReader final : public IMemoryReader
+{
+public:
+	explicit FSnapshotMemoryReader(const FString& SnapshotPath);
+	virtual ~FSnapshotMemoryReader() override;
+
+	virtual bool IsValid() const override { return PageAddresses != nullptr; }
+
+protected:
+	virtual bool ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size) override;
+	virtual bool ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize) override;
+
+private:
+	bool CopyRange(uint64 Address, uint8* OutData, uint64 Size) const;
+
+	IMappedFileHandle* MappedFile = nullptr;
+	IMappedFileRegion* MappedRegion = nullptr;
+
+	const uint64* PageAddresses = nullptr;
+	const uint8* PageData = nullptr;
+	uint64 PageCount = 0;
+	uint64 PageSize = 0;
+};
@@ -4,6 +4,10 @@
 #include "SeLogChannels.h"
 #include "Interface/IMemoryReader.h"
 
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+
 class FWindowsMemoryReader final : public IMemoryReader
 {
 public:
@@ -11,19 +15,15 @@ public:
 	virtual ~FWindowsMemoryReader() override;
 
 	virtual bool IsValid() const override { return ProcessHandle != nullptr; }
-	virtual HANDLE GetProcessHandle() const override { return ProcessHandle; }
-
-	virtual bool ReadString(uint64 Address, FString& OutString, int MaxLength = 20480) override;
+	HANDLE GetProcessHandle() const { return ProcessHandle; }
 
 protected:
 	virtual bool ReadMemoryImpl(uint64 Address, void* OutResult, size_t Size) override;
 	virtual bool ReadArrayImpl(uint64 Address, void* OutArrayData, uint64 Length, size_t ElementSize) override;
 
-	bool ReadNullTerminatedString(uint64 Address, TArray<ANSICHAR>& OutBuffer, int32 MaxLength);
-
 private:
+	// ReadProcessMemory is safe to call concurrently on one handle, so reads take no lock.
 	HANDLE ProcessHandle = nullptr;
-	FCriticalSection ReadLock;
 
 	static HANDLE OpenTargetProcess(DWORD ProcessId);
 };